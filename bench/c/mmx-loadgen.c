@@ -0,0 +1,652 @@
+/* mmx-loadgen.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Load generator for the front-end API: N threads, each with its own
+ * connection, send GetParamValue requests to the Entry-Point (normally
+ * the mock one, see mmx-mock-ep.c) and wait for all response fragments.
+ * Throughput and latency percentiles of the whole requests are reported.
+ *
+ * Modes:
+ *   msg - requests are made with mmx_frontapi_make_request (build + parse)
+ *   xml - pre-built XML requests are made with mmx_frontapi_make_xml_request
+ *   notify - every thread subscribes to the path and counts the value-change
+ *            notifications sent by the mock (mmx-mock-ep -u), coalesced
+ *            within -N ms (see mmx-frontapi-notify.h)
+ *
+ * With -s the library statistics of all connections are printed as well
+ * (see mmx-frontapi-stats.h). With -c the traffic of all connections is
+ * captured to the file (see mmx-frontapi-capture.h and mmx-replay.c).
+ * With -S requests of msg mode are answered from the snapshot published
+ * by the mock (mmx-mock-ep -S) if the values are not older than -A ms,
+ * e.g. -P Device.Bench.Obj.1.Param1 (see mmx-frontapi-snapshot.h).
+ * With -D requests of msg mode are delta GetParamValue requests, merged
+ * into a per-thread cache (see mmx-frontapi-delta.h).
+ *
+ * Usage: mmx-loadgen [-p port] [-t threads] [-d seconds | -n requests_per_thread]
+ *                    [-m msg|xml|notify] [-P param_path] [-T timeout] [-j] [-s]
+ *                    [-c capture_file] [-S snapshot_file [-A max_age_ms]]
+ *                    [-N coalesce_ms] [-D]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-stats.h"
+#include "mmx-frontapi-capture.h"
+#include "mmx-frontapi-snapshot.h"
+#include "mmx-frontapi-notify.h"
+#include "mmx-frontapi-delta.h"
+#include "mmx-bench.h"
+
+#define LOADGEN_MAX_THREADS  256
+#define LOADGEN_CAPTURE_SIZE (256UL << 20)
+#define LOADGEN_DELTA_SIZE   (1U << 20)      /* each of the delta cache buffers */
+
+typedef enum loadgen_mode_e {
+    LOADGEN_MODE_MSG = 0,
+    LOADGEN_MODE_XML,
+    LOADGEN_MODE_NOTIFY
+} loadgen_mode_t;
+
+typedef struct loadgen_cfg_s {
+    in_port_t port;
+    unsigned threads;
+    unsigned duration;      /* seconds, used if requests == 0 */
+    unsigned long requests; /* requests per thread */
+    loadgen_mode_t mode;
+    const char *path;
+    unsigned timeout;
+    int json;
+    int stats;
+    const char *capture;
+    const char *snapshot;
+    unsigned max_age_ms;
+    unsigned coalesce_ms;
+    int delta;
+} loadgen_cfg_t;
+
+typedef struct loadgen_thread_s {
+    pthread_t tid;
+    unsigned idx;
+    unsigned long done;
+    unsigned long errors;
+    unsigned long fragments;
+    size_t capacity;
+    uint64_t *lat_ns;
+    mmx_notify_t *notify;
+    unsigned long callbacks; /* notify mode: notifications delivered */
+    unsigned long values;    /* and values in them */
+    mmx_delta_cache_t *cache;
+} loadgen_thread_t;
+
+static loadgen_cfg_t cfg = {
+    .port = 10199, .threads = 4, .duration = 10, .requests = 0,
+    .mode = LOADGEN_MODE_MSG, .path = "Device.Bench.Obj.1.", .timeout = 2, .json = 0,
+    .max_age_ms = 2000
+};
+
+static volatile int stop;
+
+/* Shared by connections of all threads */
+static mmx_ep_stats_t lib_stats;
+static mmx_capture_t capture;
+static mmx_snapshot_t snapshot;
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-p port] [-t threads] [-d seconds | -n requests_per_thread]\n"
+                    "          [-m msg|xml|notify] [-P param_path] [-T timeout] [-j] [-s]\n"
+                    "          [-c capture_file] [-S snapshot_file [-A max_age_ms]]\n"
+                    "          [-N coalesce_ms] [-D]\n", prog);
+}
+
+static int add_sample(loadgen_thread_t *th, uint64_t ns)
+{
+    uint64_t *tmp;
+
+    if (th->done == th->capacity)
+    {
+        th->capacity = th->capacity ? th->capacity * 2 : 4096;
+        if ((tmp = realloc(th->lat_ns, th->capacity * sizeof(*tmp))) == NULL)
+            return FA_NOT_ENOUGH_MEMORY;
+        th->lat_ns = tmp;
+    }
+    th->lat_ns[th->done++] = ns;
+    return FA_OK;
+}
+
+/* Fills GetParamValue request */
+static void fill_request(ep_message_t *msg, char *pool, size_t pool_size,
+                         int txaId, in_port_t own_port)
+{
+    mmx_frontapi_msg_struct_init(msg, pool, pool_size);
+
+    msg->header.callerId = MMX_API_CALLERID_CLI;
+    msg->header.txaId = txaId;
+    msg->header.respMode = MMX_API_RESPMODE_SYNC;
+    msg->header.respIpAddr = htonl(INADDR_LOOPBACK);
+    msg->header.respPort = own_port;
+    msg->header.msgType = MSGTYPE_GETVALUE;
+
+    msg->body.getParamValue.nextLevel = 0;
+    msg->body.getParamValue.configOnly = 0;
+    msg->body.getParamValue.arraySize = 1;
+    strcpy_safe(msg->body.getParamValue.paramNames[0], cfg.path, NVP_MAX_NAME_LEN);
+}
+
+static void notify_cb(uint32_t subscriptionId, const nvpair_t *values, int count, void *arg)
+{
+    loadgen_thread_t *th = arg;
+
+    (void)subscriptionId;
+    (void)values;
+    th->callbacks++;
+    th->values += count;
+}
+
+/*
+ * Notify mode: subscribes to the parameter path and receives
+ * notifications until the end of the test
+ */
+static void run_notify(loadgen_thread_t *th, mmx_ep_connection_t *conn, ep_message_t *msg,
+                       char *pool, size_t pool_size, in_port_t own_port)
+{
+    uint32_t subscriptionId;
+    int more = 0;
+
+    if ((th->notify = malloc(sizeof(*th->notify))) == NULL ||
+        mmx_notify_init(th->notify, notify_cb, th, cfg.coalesce_ms) != FA_OK)
+    {
+        th->errors++;
+        return;
+    }
+    mmx_frontapi_set_notify(conn, th->notify);
+
+    fill_request(msg, pool, pool_size, (int)((th->idx + 1) * 1000000), own_port);
+    msg->header.msgType = MSGTYPE_SUBSCRIBE;
+    msg->body.subscribe.minInterval = 0;
+    msg->body.subscribe.arraySize = 1;
+    strcpy_safe(msg->body.subscribe.paramNames[0], cfg.path, NVP_MAX_NAME_LEN);
+    if (mmx_frontapi_make_request(conn, msg, &more) != FA_OK || msg->header.respCode != MMX_API_RC_OK)
+    {
+        fprintf(stderr, "loadgen: thread %u could not subscribe to %s\n", th->idx, cfg.path);
+        th->errors++;
+        return;
+    }
+    subscriptionId = msg->body.subscribeResponse.subscriptionId;
+
+    while (!stop)
+        if (mmx_frontapi_dispatch(conn, 100) != FA_OK)
+            th->errors++;
+    mmx_notify_flush(th->notify);
+
+    fill_request(msg, pool, pool_size, (int)((th->idx + 1) * 1000000 + 1), own_port);
+    msg->header.msgType = MSGTYPE_UNSUBSCRIBE;
+    msg->body.unsubscribe.subscriptionId = subscriptionId;
+    if (mmx_frontapi_make_request(conn, msg, &more) != FA_OK || msg->header.respCode != MMX_API_RC_OK)
+        th->errors++;
+}
+
+/*
+ * Makes one request and receives all its fragments.
+ * Returns FA_OK or error code.
+ */
+static int make_one(loadgen_thread_t *th, mmx_ep_connection_t *conn, ep_message_t *msg,
+                    char *pool, size_t pool_size, char *xml, size_t xml_size, int txaId)
+{
+    char buf[MMXFA_MAX_DATAGRAM_SIZE];
+    ep_msg_header_t hdr;
+    size_t rcvd;
+    int more = 0, res;
+
+    /* All fragments are received and merged by the delta cache */
+    if (cfg.mode == LOADGEN_MODE_MSG && cfg.delta)
+    {
+        th->fragments++;
+        return mmx_delta_cache_make_request(conn, th->cache, msg);
+    }
+
+    if (cfg.mode == LOADGEN_MODE_MSG && cfg.snapshot)
+        res = mmx_snapshot_make_request(conn, &snapshot, msg, cfg.max_age_ms, &more);
+    else if (cfg.mode == LOADGEN_MODE_MSG)
+        res = mmx_frontapi_make_request(conn, msg, &more);
+    else
+        res = mmx_frontapi_make_xml_request(conn, xml, xml_size, &more);
+    if (res != FA_OK)
+        return res;
+    th->fragments++;
+
+    while (more)
+    {
+        if ((res = mmx_frontapi_receive_resp(conn, txaId, buf, sizeof(buf) - 1, &rcvd)) != 0)
+            return res;
+        th->fragments++;
+
+        if (cfg.mode == LOADGEN_MODE_MSG)
+        {
+            mmx_frontapi_msg_struct_init(msg, pool, pool_size);
+            if ((res = mmx_frontapi_message_parse_ex(buf, msg, conn->path_dict)) != FA_OK)
+                return res;
+            more = msg->header.moreFlag;
+        }
+        else
+        {
+            memset(&hdr, 0, sizeof(hdr));
+            if ((res = mmx_frontapi_msg_header_parse(buf, &hdr)) != FA_OK)
+                return res;
+            more = hdr.moreFlag;
+        }
+    }
+
+    return FA_OK;
+}
+
+static void *loadgen_thread(void *arg)
+{
+    loadgen_thread_t *th = arg;
+    mmx_ep_connection_t conn;
+    struct sockaddr_in own;
+    socklen_t own_len = sizeof(own);
+    ep_message_t *msg = NULL;
+    char *pool = NULL, *xml = NULL, *xml_req = NULL, *names = NULL, *values = NULL;
+    size_t pool_size = MMXFA_MAX_DATAGRAM_SIZE, xml_size = MMXFA_MAX_DATAGRAM_SIZE;
+    unsigned long seq = 0;
+    uint64_t start;
+    int txaId;
+
+    if (mmx_frontapi_connect(&conn, 0, cfg.timeout) != 0)
+    {
+        fprintf(stderr, "loadgen: thread %u could not connect\n", th->idx);
+        return NULL;
+    }
+    conn.dest.sin_port = htons(cfg.port);
+    if (cfg.stats)
+        mmx_frontapi_set_stats(&conn, &lib_stats);
+    if (cfg.capture)
+        mmx_frontapi_set_capture(&conn, &capture);
+    getsockname(conn.sock, (struct sockaddr *)&own, &own_len);
+
+    msg = malloc(sizeof(*msg));
+    pool = malloc(pool_size);
+    xml = malloc(xml_size);
+    xml_req = malloc(xml_size);
+    if (!msg || !pool || !xml || !xml_req)
+    {
+        fprintf(stderr, "loadgen: thread %u - not enough memory\n", th->idx);
+        goto ret;
+    }
+
+    if (cfg.delta && ((th->cache = malloc(sizeof(*th->cache))) == NULL ||
+                      (names = malloc(LOADGEN_DELTA_SIZE)) == NULL ||
+                      (values = malloc(LOADGEN_DELTA_SIZE)) == NULL ||
+                      mmx_delta_cache_init(th->cache, names, LOADGEN_DELTA_SIZE,
+                                           values, LOADGEN_DELTA_SIZE) != FA_OK))
+    {
+        fprintf(stderr, "loadgen: thread %u - not enough memory\n", th->idx);
+        goto ret;
+    }
+
+    if (cfg.mode == LOADGEN_MODE_NOTIFY)
+    {
+        run_notify(th, &conn, msg, pool, pool_size, ntohs(own.sin_port));
+        goto ret;
+    }
+
+    while (!stop && (cfg.requests == 0 || seq < cfg.requests))
+    {
+        txaId = (int)((th->idx + 1) * 1000000 + seq % 1000000);
+        seq++;
+
+        /* Request is prepared outside of the measured interval */
+        fill_request(msg, pool, pool_size, txaId, ntohs(own.sin_port));
+        if (cfg.mode == LOADGEN_MODE_XML)
+        {
+            if (mmx_frontapi_message_build(msg, xml_req, xml_size) != FA_OK)
+            {
+                th->errors++;
+                continue;
+            }
+            strcpy_safe(xml, xml_req, xml_size);
+        }
+
+        start = mmx_bench_now_ns();
+        if (make_one(th, &conn, msg, pool, pool_size, xml, xml_size, txaId) != FA_OK)
+            th->errors++;
+        else if (add_sample(th, mmx_bench_now_ns() - start) != FA_OK)
+            break;
+    }
+
+ret:
+    free(msg);
+    free(pool);
+    free(xml);
+    free(xml_req);
+    free(names);
+    free(values);
+    mmx_frontapi_close(&conn);
+    return NULL;
+}
+
+static void print_stats(void)
+{
+    mmx_ep_stats_t snap;
+    const mmx_stats_hist_t *h;
+    int i;
+
+    mmx_frontapi_stats_snapshot(&lib_stats, &snap, 0);
+
+    if (cfg.json)
+    {
+        printf("{\"timeouts\": %llu, \"discarded\": %llu, \"send_errors\": %llu, "
+               "\"packets_sent\": %llu, \"packets_received\": %llu, "
+               "\"bytes_sent\": %llu, \"bytes_received\": %llu, \"phases\": {",
+               (unsigned long long)snap.timeouts, (unsigned long long)snap.discarded,
+               (unsigned long long)snap.send_errors, (unsigned long long)snap.packets_sent,
+               (unsigned long long)snap.packets_received, (unsigned long long)snap.bytes_sent,
+               (unsigned long long)snap.bytes_received);
+        for (i = 0; i < MMX_STATS_PHASE_LAST; i++)
+        {
+            h = &snap.phases[i];
+            printf("%s\"%s\": {\"count\": %llu, \"mean_us\": %.1f, \"p50_us\": %llu, "
+                   "\"p99_us\": %llu, \"max_us\": %llu}", i ? ", " : "",
+                   mmx_frontapi_stats_phase2str(i), (unsigned long long)h->count,
+                   h->count ? (double)h->sum_us / h->count : 0.0,
+                   (unsigned long long)mmx_frontapi_stats_percentile(h, 0.50),
+                   (unsigned long long)mmx_frontapi_stats_percentile(h, 0.99),
+                   (unsigned long long)h->max_us);
+        }
+        printf("}}\n");
+        return;
+    }
+
+    printf("library: timeouts %llu, discarded %llu, send errors %llu, "
+           "packets %llu/%llu, bytes %llu/%llu (sent/received)\n",
+           (unsigned long long)snap.timeouts, (unsigned long long)snap.discarded,
+           (unsigned long long)snap.send_errors, (unsigned long long)snap.packets_sent,
+           (unsigned long long)snap.packets_received, (unsigned long long)snap.bytes_sent,
+           (unsigned long long)snap.bytes_received);
+    for (i = 0; i < MMX_STATS_PHASE_LAST; i++)
+    {
+        h = &snap.phases[i];
+        printf("  %-6s count %llu, mean %.1f us, p50 <%llu us, p99 <%llu us, max %llu us\n",
+               mmx_frontapi_stats_phase2str(i), (unsigned long long)h->count,
+               h->count ? (double)h->sum_us / h->count : 0.0,
+               (unsigned long long)mmx_frontapi_stats_percentile(h, 0.50),
+               (unsigned long long)mmx_frontapi_stats_percentile(h, 0.99),
+               (unsigned long long)h->max_us);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    loadgen_thread_t threads[LOADGEN_MAX_THREADS];
+    unsigned long total = 0, errors = 0, fragments = 0, callbacks = 0, values = 0;
+    uint64_t received = 0, coalesced = 0;
+    mmx_delta_cache_t delta;
+    uint64_t *all, start, elapsed;
+    double secs, rate;
+    unsigned i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "p:t:d:n:m:P:T:jsc:S:A:N:Dh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'p': cfg.port = (in_port_t)atoi(optarg); break;
+        case 't': cfg.threads = (unsigned)atoi(optarg); break;
+        case 'd': cfg.duration = (unsigned)atoi(optarg); break;
+        case 'n': cfg.requests = strtoul(optarg, NULL, 10); break;
+        case 'm':
+            if (!strcmp(optarg, "msg"))
+                cfg.mode = LOADGEN_MODE_MSG;
+            else if (!strcmp(optarg, "xml"))
+                cfg.mode = LOADGEN_MODE_XML;
+            else if (!strcmp(optarg, "notify"))
+                cfg.mode = LOADGEN_MODE_NOTIFY;
+            else
+            {
+                usage(argv[0]);
+                return 1;
+            }
+            break;
+        case 'P': cfg.path = optarg; break;
+        case 'T': cfg.timeout = (unsigned)atoi(optarg); break;
+        case 'j': cfg.json = 1; break;
+        case 's': cfg.stats = 1; break;
+        case 'c': cfg.capture = optarg; break;
+        case 'S': cfg.snapshot = optarg; break;
+        case 'A': cfg.max_age_ms = (unsigned)atoi(optarg); break;
+        case 'N': cfg.coalesce_ms = (unsigned)atoi(optarg); break;
+        case 'D': cfg.delta = 1; break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (cfg.threads == 0 || cfg.threads > LOADGEN_MAX_THREADS)
+    {
+        fprintf(stderr, "loadgen: number of threads must be 1..%d\n", LOADGEN_MAX_THREADS);
+        return 1;
+    }
+
+    if (cfg.capture && mmx_capture_open(&capture, cfg.capture, LOADGEN_CAPTURE_SIZE) != FA_OK)
+    {
+        fprintf(stderr, "loadgen: could not create capture file %s\n", cfg.capture);
+        return 1;
+    }
+
+    if (cfg.snapshot && mmx_snapshot_attach(&snapshot, cfg.snapshot) != FA_OK)
+    {
+        fprintf(stderr, "loadgen: could not attach snapshot file %s\n", cfg.snapshot);
+        return 1;
+    }
+
+    memset(threads, 0, sizeof(threads));
+    memset(&delta, 0, sizeof(delta));
+    start = mmx_bench_now_ns();
+    for (i = 0; i < cfg.threads; i++)
+    {
+        threads[i].idx = i;
+        if (pthread_create(&threads[i].tid, NULL, loadgen_thread, &threads[i]) != 0)
+        {
+            perror("loadgen: pthread_create");
+            return 1;
+        }
+    }
+
+    if (cfg.requests == 0 || cfg.mode == LOADGEN_MODE_NOTIFY)
+    {
+        sleep(cfg.duration);
+        stop = 1;
+    }
+
+    for (i = 0; i < cfg.threads; i++)
+    {
+        pthread_join(threads[i].tid, NULL);
+        total += threads[i].done;
+        errors += threads[i].errors;
+        fragments += threads[i].fragments;
+        callbacks += threads[i].callbacks;
+        values += threads[i].values;
+        if (threads[i].notify)
+        {
+            received += threads[i].notify->received;
+            coalesced += threads[i].notify->coalesced;
+            free(threads[i].notify);
+        }
+        if (threads[i].cache)
+        {
+            delta.full += threads[i].cache->full;
+            delta.changes += threads[i].cache->changes;
+            delta.not_modified += threads[i].cache->not_modified;
+            delta.changed_values += threads[i].cache->changed_values;
+            delta.incomplete_responses += threads[i].cache->incomplete_responses;
+            free(threads[i].cache);
+        }
+    }
+    elapsed = mmx_bench_now_ns() - start;
+
+    if (cfg.capture)
+    {
+        if (capture.hdr->dropped)
+            fprintf(stderr, "loadgen: capture file is full, %llu packets dropped\n",
+                    (unsigned long long)capture.hdr->dropped);
+        mmx_capture_close(&capture);
+    }
+
+    if (cfg.mode == LOADGEN_MODE_NOTIFY)
+    {
+        secs = elapsed / 1e9;
+        if (cfg.json)
+            printf("{\"mode\": \"notify\", \"threads\": %u, \"coalesce_ms\": %u, \"errors\": %lu, "
+                   "\"messages\": %llu, \"callbacks\": %lu, \"values\": %lu, \"coalesced\": %llu, "
+                   "\"elapsed_s\": %.3f}\n", cfg.threads, cfg.coalesce_ms, errors,
+                   (unsigned long long)received, callbacks, values,
+                   (unsigned long long)coalesced, secs);
+        else
+        {
+            printf("mode notify, threads %u, path %s, coalesce %u ms\n",
+                   cfg.threads, cfg.path, cfg.coalesce_ms);
+            printf("Notify messages %llu, callbacks %lu (%.1f/s), values %lu, coalesced %llu, errors %lu\n",
+                   (unsigned long long)received, callbacks, secs > 0 ? callbacks / secs : 0.0,
+                   values, (unsigned long long)coalesced, errors);
+        }
+        if (cfg.stats)
+            print_stats();
+        return errors ? 2 : 0;
+    }
+
+    all = malloc((total ? total : 1) * sizeof(*all));
+    if (all == NULL)
+    {
+        fprintf(stderr, "loadgen: not enough memory\n");
+        return 1;
+    }
+    total = 0;
+    for (i = 0; i < cfg.threads; i++)
+    {
+        if (threads[i].done)
+            memcpy(all + total, threads[i].lat_ns, threads[i].done * sizeof(*all));
+        total += threads[i].done;
+        free(threads[i].lat_ns);
+    }
+    qsort(all, total, sizeof(*all), mmx_bench_cmp_u64);
+
+    secs = elapsed / 1e9;
+    rate = secs > 0 ? total / secs : 0;
+
+    if (cfg.json)
+    {
+        printf("{\"mode\": \"%s\", \"threads\": %u, \"requests\": %lu, \"errors\": %lu, "
+               "\"fragments\": %lu, \"elapsed_s\": %.3f, \"throughput_rps\": %.1f, "
+               "\"p50_us\": %.1f, \"p99_us\": %.1f, \"p999_us\": %.1f, \"max_us\": %.1f}\n",
+               cfg.mode == LOADGEN_MODE_MSG ? "msg" : "xml", cfg.threads, total, errors,
+               fragments, secs, rate,
+               mmx_bench_percentile(all, total, 0.50) / 1e3,
+               mmx_bench_percentile(all, total, 0.99) / 1e3,
+               mmx_bench_percentile(all, total, 0.999) / 1e3,
+               mmx_bench_percentile(all, total, 1.0) / 1e3);
+    }
+    else
+    {
+        printf("mode %s, threads %u, path %s\n",
+               cfg.mode == LOADGEN_MODE_MSG ? "msg" : "xml", cfg.threads, cfg.path);
+        printf("requests %lu (%lu fragments), errors %lu, %.3f s, %.1f req/s\n",
+               total, fragments, errors, secs, rate);
+        printf("latency us: p50 %.1f, p99 %.1f, p999 %.1f, max %.1f\n",
+               mmx_bench_percentile(all, total, 0.50) / 1e3,
+               mmx_bench_percentile(all, total, 0.99) / 1e3,
+               mmx_bench_percentile(all, total, 0.999) / 1e3,
+               mmx_bench_percentile(all, total, 1.0) / 1e3);
+        if (cfg.delta)
+            printf("delta: %llu full responses, %llu with changes (%llu values), %llu not modified, "
+                   "%llu incomplete\n",
+                   (unsigned long long)delta.full, (unsigned long long)delta.changes,
+                   (unsigned long long)delta.changed_values,
+                   (unsigned long long)delta.not_modified,
+                   (unsigned long long)delta.incomplete_responses);
+        if (cfg.snapshot)
+            printf("snapshot: %llu requests answered locally, %llu sent to the Entry-Point\n",
+                   (unsigned long long)snapshot.local, (unsigned long long)snapshot.remote);
+    }
+
+    if (cfg.snapshot)
+        mmx_snapshot_close(&snapshot);
+    if (cfg.stats)
+        print_stats();
+
+    free(all);
+    return errors ? 2 : 0;
+}
@@ -0,0 +1,890 @@
+/* mmx-mock-ep.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Mock MMX Entry-Point used for end-to-end benchmarks of the front-end API.
+ *
+ * Requests are parsed and responses are built with the front-end library
+ * itself, using messages of the library message pool (as an Entry-Point
+ * worker would). The synthetic data model consists of one table
+ * "Device.Bench.Obj.{i}." with the configured number of instances, each
+ * having parameters "Param1".."ParamK" with values of the configured length.
+ * Responses may be delayed, requests may be dropped (loss) and
+ * GetParamValue responses are split into fragments of the given size.
+ * Fragments are also limited by the datagram size: the client receives the
+ * first response of a request into a 2 KB buffer, so this is the default.
+ *
+ * With -S the mock also acts as a backend publishing all parameters to the
+ * snapshot file once a second (see mmx-frontapi-snapshot.h); load generator
+ * with the same -S serves its requests from the snapshot.
+ *
+ * With -u values of one instance (round robin) change every given number
+ * of microseconds and subscribers (Subscribe request) get Notify messages
+ * with the changed values of their parameters, at most one per their
+ * minInterval (see mmx-frontapi-notify.h and mmx-loadgen -m notify).
+ *
+ * GetParamValue requests with version (see mmx-frontapi-delta.h) are
+ * answered with the values of the instances changed since that version
+ * or with "not modified"; every change makes a new version.
+ *
+ * Usage: mmx-mock-ep [-p port] [-n instances] [-k params] [-v value_len]
+ *                    [-f pairs_per_fragment] [-s max_datagram]
+ *                    [-l latency_us] [-L loss_percent] [-S snapshot_file]
+ *                    [-u change_interval_us]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/select.h>
+#include <arpa/inet.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-msgpool.h"
+#include "mmx-frontapi-snapshot.h"
+#include "mmx-bench.h"
+
+#define MOCK_OBJ_PATH       "Device.Bench.Obj."
+#define MOCK_MAX_PENDING    1024
+#define MOCK_HDR_SIZE       512     /* estimated size of message without body */
+#define MOCK_PAIR_SIZE      100     /* estimated size of name-value pair without value */
+#define MOCK_MAX_SUBS       64
+
+typedef struct mock_cfg_s {
+    in_port_t port;
+    unsigned instances;
+    unsigned params;        /* parameters per instance */
+    unsigned value_len;
+    unsigned frag_pairs;    /* max name-value pairs in one response fragment */
+    unsigned max_dgram;     /* max size of response datagram */
+    unsigned latency_us;
+    unsigned loss_pct;
+    const char *snapshot;
+    unsigned change_us;     /* interval of value changes, 0 - values do not change */
+} mock_cfg_t;
+
+/* Response waiting for its send time (responses are delayed by latency) */
+typedef struct mock_pending_s {
+    uint64_t due_ns;
+    struct sockaddr_in to;
+    size_t len;
+    char *data;
+} mock_pending_t;
+
+/* Part of the data model selected by a requested name */
+typedef struct mock_range_s {
+    unsigned first_inst, last_inst;
+    unsigned first_param, last_param;
+} mock_range_t;
+
+/* Subscription to value changes */
+typedef struct mock_sub_s {
+    uint32_t id;                /* 0 - free */
+    ep_msg_header_t hdr;        /* header of Subscribe request (address of the subscriber) */
+    uint64_t min_interval_ns;
+    uint64_t sent_ns;           /* time of the last Notify */
+    unsigned count;
+    mock_range_t ranges[MSG_MAX_NUMBER_OF_GET_PARAMS];
+    unsigned char *dirty;       /* changed instances not notified yet */
+    int has_dirty;
+} mock_sub_t;
+
+typedef struct mock_stats_s {
+    unsigned long requests;
+    unsigned long responses;
+    unsigned long dropped;
+    unsigned long bad;
+    unsigned long oversize;
+    unsigned long changes;
+    unsigned long notifications;
+    unsigned long deltas;
+    unsigned long not_modified;
+} mock_stats_t;
+
+static mock_cfg_t cfg = {
+    .port = 10199, .instances = 100, .params = 8, .value_len = 16,
+    .frag_pairs = 64, .max_dgram = 2048, .latency_us = 0, .loss_pct = 0
+};
+
+static int sock = -1;
+static mock_stats_t stats;
+static volatile sig_atomic_t stop;
+
+static mock_pending_t pending[MOCK_MAX_PENDING];
+static unsigned pending_head, pending_count;
+
+/* Current request and its response, taken from the message pool */
+static ep_message_t *req, *resp;
+static char out_buf[MMXFA_MAX_DATAGRAM_SIZE];
+
+static mmx_snapshot_t snapshot;
+
+/* Versions of the values of instances changed by -u (instances existing at start) */
+static unsigned *versions;
+static unsigned versioned, next_change;
+static mock_sub_t subs[MOCK_MAX_SUBS];
+static uint32_t last_sub_id;
+
+/* Versions of the values for delta GetParamValue; the first one differs between runs */
+static uint32_t first_version, last_version;
+static uint32_t *changed_at;    /* version of the last change of instance */
+
+static void on_signal(int sig)
+{
+    stop = 1;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-p port] [-n instances] [-k params] [-v value_len]\n"
+                    "          [-f pairs_per_fragment] [-s max_datagram]\n"
+                    "          [-l latency_us] [-L loss_percent] [-S snapshot_file]\n"
+                    "          [-u change_interval_us]\n", prog);
+}
+
+static void send_now(const struct sockaddr_in *to, const char *data, size_t len)
+{
+    if (sendto(sock, data, len, 0, (const struct sockaddr *)to, sizeof(*to)) < 0)
+        perror("mock-ep: sendto");
+    else
+        stats.responses++;
+}
+
+/* Sends the due responses; returns time (ns) till the next one or 0 if none */
+static uint64_t flush_pending(void)
+{
+    uint64_t now = mmx_bench_now_ns();
+    mock_pending_t *p;
+
+    while (pending_count > 0)
+    {
+        p = &pending[pending_head];
+        if (p->due_ns > now)
+            return p->due_ns - now;
+
+        send_now(&p->to, p->data, p->len);
+        free(p->data);
+        pending_head = (pending_head + 1) % MOCK_MAX_PENDING;
+        pending_count--;
+    }
+    return 0;
+}
+
+/* Builds response message and sends it (or queues if latency is set) */
+static int send_response(ep_message_t *msg)
+{
+    struct sockaddr_in to;
+    mock_pending_t *p;
+    size_t len;
+
+    if (mmx_frontapi_message_build(msg, out_buf, sizeof(out_buf)) != FA_OK)
+    {
+        fprintf(stderr, "mock-ep: could not build %s\n", msgtype2str(msg->header.msgType));
+        return FA_GENERAL_ERROR;
+    }
+    len = strlen(out_buf) + 1;
+    if (len > cfg.max_dgram)
+        stats.oversize++;
+
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = msg->header.respIpAddr;
+    to.sin_port = htons(msg->header.respPort);
+
+    if (cfg.latency_us == 0)
+    {
+        send_now(&to, out_buf, len);
+        return FA_OK;
+    }
+
+    if (pending_count == MOCK_MAX_PENDING)
+    {
+        stats.dropped++;
+        return FA_NOT_ENOUGH_MEMORY;
+    }
+
+    p = &pending[(pending_head + pending_count) % MOCK_MAX_PENDING];
+    if ((p->data = malloc(len)) == NULL)
+        return FA_NOT_ENOUGH_MEMORY;
+    memcpy(p->data, out_buf, len);
+    p->len = len;
+    p->to = to;
+    p->due_ns = mmx_bench_now_ns() + (uint64_t)cfg.latency_us * 1000;
+    pending_count++;
+
+    return FA_OK;
+}
+
+/* Prepares response to the current request */
+static void init_response(msgtype_t type, int respCode)
+{
+    mmx_frontapi_msg_struct_reset(resp);
+
+    /* The body is not cleared by the reset: the counters used by the handlers are */
+    resp->body.getParamValueResponse.arraySize = 0;
+    resp->body.getParamValueResponse.totalNVSize = 0;
+    resp->body.getParamNamesResponse.arraySize = 0;
+
+    resp->header = req->header;
+    resp->header.respFlag = 1;
+    resp->header.msgType = type;
+    resp->header.respCode = respCode;
+    resp->header.moreFlag = 0;
+    resp->header.pathDict = 0;
+    resp->header.version = 0;
+    resp->header.delta = MMX_DELTA_FULL;
+    resp->header.fragment = 0;
+}
+
+/* Instance is sent in response to request of the version 'since' (0 - all values) */
+static int changed_since(unsigned inst, uint32_t since)
+{
+    if (since == 0)
+        return 1;
+    return changed_at && inst <= versioned && changed_at[inst - 1] > since;
+}
+
+/*
+ * Maps requested name to the range of the data model:
+ * "Device.Bench.Obj.", "Device.Bench.Obj.*.", "Device.Bench.Obj.<i>."
+ * and the same with "Param<k>" at the end.
+ */
+static int name_to_range(const char *name, mock_range_t *range)
+{
+    const char *p = name + strlen(MOCK_OBJ_PATH);
+    char *end;
+    unsigned long val;
+
+    if (strncmp(name, MOCK_OBJ_PATH, strlen(MOCK_OBJ_PATH)))
+        return -1;
+
+    range->first_inst = 1;
+    range->last_inst = cfg.instances;
+    range->first_param = 1;
+    range->last_param = cfg.params;
+
+    if (*p == '\0')
+        return 0;
+
+    if (*p == '*')
+        end = (char *)p + 1;
+    else
+    {
+        val = strtoul(p, &end, 10);
+        if (end == p || val == 0 || val > cfg.instances)
+            return -1;
+        range->first_inst = range->last_inst = (unsigned)val;
+    }
+
+    if (*end != '.')
+        return -1;
+    p = end + 1;
+    if (*p == '\0')
+        return 0;
+
+    if (strncmp(p, "Param", 5))
+        return -1;
+    val = strtoul(p + 5, &end, 10);
+    if (*end != '\0' || val == 0 || val > cfg.params)
+        return -1;
+    range->first_param = range->last_param = (unsigned)val;
+
+    return 0;
+}
+
+static void make_value(unsigned inst, unsigned param, char *buf, size_t size)
+{
+    int len;
+
+    if (inst <= versioned && versions[inst - 1])
+        len = snprintf(buf, size, "v%u.%u.%u-", inst, param, versions[inst - 1]);
+    else
+        len = snprintf(buf, size, "v%u.%u-", inst, param);
+
+    while (len < (int)cfg.value_len && len < (int)size - 1)
+        buf[len++] = 'x';
+    buf[len] = '\0';
+}
+
+static void handle_getvalue(void)
+{
+    mock_range_t ranges[MSG_MAX_NUMBER_OF_GET_PARAMS];
+    ep_getParamValue_resp_t *body = &resp->body.getParamValueResponse;
+    char name[NVP_MAX_NAME_LEN], value[MSG_MAX_STR_LEN * 4];
+    unsigned long total = 0, sent = 0;
+    unsigned i, inst, param, count = req->body.getParamValue.arraySize;
+    uint16_t fragment = 1;
+    uint32_t since = req->header.version;
+    int delta;
+
+    /* Unknown version (e.g. of a previous run) - all values */
+    if (since < first_version || since > last_version)
+        since = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        if (name_to_range(req->body.getParamValue.paramNames[i], &ranges[i]) != 0)
+        {
+            init_response(MSGTYPE_GETVALUE_RESP, MMX_API_RC_INVALID_PARAM_NAME);
+            send_response(resp);
+            return;
+        }
+        for (inst = ranges[i].first_inst; inst <= ranges[i].last_inst; inst++)
+            if (changed_since(inst, since))
+                total += ranges[i].last_param - ranges[i].first_param + 1;
+    }
+
+    delta = since == 0 ? MMX_DELTA_FULL : total ? MMX_DELTA_CHANGES : MMX_DELTA_NOT_MODIFIED;
+    if (delta == MMX_DELTA_CHANGES)
+        stats.deltas++;
+    else if (delta == MMX_DELTA_NOT_MODIFIED)
+        stats.not_modified++;
+
+    init_response(MSGTYPE_GETVALUE_RESP, MMX_API_RC_OK);
+    resp->header.version = last_version;
+    resp->header.delta = delta;
+    for (i = 0; i < count; i++)
+    {
+        for (inst = ranges[i].first_inst; inst <= ranges[i].last_inst; inst++)
+        {
+            if (!changed_since(inst, since))
+                continue;
+
+            for (param = ranges[i].first_param; param <= ranges[i].last_param; param++)
+            {
+                snprintf(name, sizeof(name), MOCK_OBJ_PATH "%u.Param%u", inst, param);
+                make_value(inst, param, value, sizeof(value));
+                mmx_frontapi_msgstruct_insert_nvpair(resp, &body->paramValues[body->arraySize],
+                                                     name, value);
+                body->arraySize++;
+                sent++;
+
+                if (body->arraySize == cfg.frag_pairs && sent < total)
+                {
+                    resp->header.moreFlag = 1;
+                    resp->header.fragment = fragment++;
+                    send_response(resp);
+                    init_response(MSGTYPE_GETVALUE_RESP, MMX_API_RC_OK);
+                    resp->header.version = last_version;
+                    resp->header.delta = delta;
+                }
+            }
+        }
+    }
+    if (fragment > 1)
+        resp->header.fragment = fragment;
+    send_response(resp);
+}
+
+/* Publishes values of all parameters to the snapshot */
+static void publish_snapshot(void)
+{
+    char name[NVP_MAX_NAME_LEN], value[MSG_MAX_STR_LEN * 4];
+    unsigned inst, param;
+
+    for (inst = 1; inst <= cfg.instances; inst++)
+    {
+        for (param = 1; param <= cfg.params; param++)
+        {
+            snprintf(name, sizeof(name), MOCK_OBJ_PATH "%u.Param%u", inst, param);
+            make_value(inst, param, value, sizeof(value));
+            mmx_snapshot_publish(&snapshot, name, value);
+        }
+    }
+}
+
+static void handle_getparamnames(void)
+{
+    ep_getParamNames_resp_t *body = &resp->body.getParamNamesResponse;
+    mock_range_t range;
+    unsigned i;
+
+    if (name_to_range(req->body.getParamNames.pathName, &range) != 0)
+    {
+        init_response(MSGTYPE_GETPARAMNAMES_RESP, MMX_API_RC_INVALID_PARAM_NAME);
+        send_response(resp);
+        return;
+    }
+
+    init_response(MSGTYPE_GETPARAMNAMES_RESP, MMX_API_RC_OK);
+    if (range.first_inst == range.last_inst)
+    {
+        for (i = range.first_param; i <= range.last_param && body->arraySize < MAX_NUMBER_OF_GPN_RESPONSE_VALUES; i++)
+        {
+            snprintf(body->paramInfo[body->arraySize].name, NVP_MAX_NAME_LEN,
+                     MOCK_OBJ_PATH "%u.Param%u", range.first_inst, i);
+            body->paramInfo[body->arraySize++].writable = '1';
+        }
+    }
+    else
+    {
+        for (i = range.first_inst; i <= range.last_inst && body->arraySize < MAX_NUMBER_OF_GPN_RESPONSE_VALUES; i++)
+        {
+            snprintf(body->paramInfo[body->arraySize].name, NVP_MAX_NAME_LEN, MOCK_OBJ_PATH "%u.", i);
+            body->paramInfo[body->arraySize++].writable = '1';
+        }
+    }
+    send_response(resp);
+}
+
+static void handle_subscribe(void)
+{
+    const ep_subscribe_req_t *body = &req->body.subscribe;
+    mock_sub_t *sub = NULL;
+    unsigned i;
+
+    for (i = 0; i < MOCK_MAX_SUBS && sub == NULL; i++)
+        if (subs[i].id == 0)
+            sub = &subs[i];
+
+    if (sub == NULL)
+    {
+        init_response(MSGTYPE_SUBSCRIBE_RESP, MMX_API_RC_RESOURCES_EXCEEDED);
+        send_response(resp);
+        return;
+    }
+
+    for (i = 0; i < body->arraySize; i++)
+    {
+        if (name_to_range(body->paramNames[i], &sub->ranges[i]) != 0)
+        {
+            init_response(MSGTYPE_SUBSCRIBE_RESP, MMX_API_RC_INVALID_PARAM_NAME);
+            send_response(resp);
+            return;
+        }
+    }
+
+    if (versioned && (sub->dirty = calloc(versioned, 1)) == NULL)
+    {
+        init_response(MSGTYPE_SUBSCRIBE_RESP, MMX_API_RC_RESOURCES_EXCEEDED);
+        send_response(resp);
+        return;
+    }
+
+    sub->id = ++last_sub_id;
+    sub->hdr = req->header;
+    sub->min_interval_ns = (uint64_t)body->minInterval * 1000000ULL;
+    sub->sent_ns = 0;
+    sub->count = body->arraySize;
+    sub->has_dirty = 0;
+
+    init_response(MSGTYPE_SUBSCRIBE_RESP, MMX_API_RC_OK);
+    resp->body.subscribeResponse.subscriptionId = sub->id;
+    resp->body.subscribeResponse.status = 0;
+    send_response(resp);
+}
+
+static void handle_unsubscribe(void)
+{
+    unsigned i;
+
+    for (i = 0; i < MOCK_MAX_SUBS; i++)
+        if (subs[i].id != 0 && subs[i].id == req->body.unsubscribe.subscriptionId)
+            break;
+
+    if (i == MOCK_MAX_SUBS)
+    {
+        init_response(MSGTYPE_UNSUBSCRIBE_RESP, MMX_API_RC_INVALID_ARGUMENT);
+        send_response(resp);
+        return;
+    }
+
+    free(subs[i].dirty);
+    memset(&subs[i], 0, sizeof(subs[i]));
+
+    init_response(MSGTYPE_UNSUBSCRIBE_RESP, MMX_API_RC_OK);
+    resp->body.unsubscribeResponse.status = 0;
+    send_response(resp);
+}
+
+/* Changes values of the next instance and marks it for its subscribers */
+static void change_values(void)
+{
+    unsigned inst = next_change++ % versioned + 1;
+    unsigned i, k;
+
+    versions[inst - 1]++;
+    changed_at[inst - 1] = ++last_version;
+    stats.changes++;
+
+    for (i = 0; i < MOCK_MAX_SUBS; i++)
+    {
+        for (k = 0; subs[i].id != 0 && k < subs[i].count; k++)
+        {
+            if (inst >= subs[i].ranges[k].first_inst && inst <= subs[i].ranges[k].last_inst)
+            {
+                subs[i].dirty[inst - 1] = 1;
+                subs[i].has_dirty = 1;
+                break;
+            }
+        }
+    }
+}
+
+/* Prepares Notify message of the subscription */
+static void init_notify(ep_message_t *msg, const mock_sub_t *sub)
+{
+    mmx_frontapi_msg_struct_reset(msg);
+    msg->header = sub->hdr;
+    msg->header.txaId = 0;
+    msg->header.respFlag = 0;
+    msg->header.msgType = MSGTYPE_NOTIFY;
+    msg->header.respCode = MMX_API_RC_OK;
+    msg->header.moreFlag = 0;
+    msg->header.pathDict = 0;
+    msg->body.notify.subscriptionId = sub->id;
+    msg->body.notify.arraySize = 0;
+}
+
+/*
+ * Sends changed values to the subscribers whose minInterval elapsed
+ * (changes made meanwhile are sent together)
+ */
+static void send_notifications(void)
+{
+    char name[NVP_MAX_NAME_LEN], value[MSG_MAX_STR_LEN * 4];
+    uint64_t now = mmx_bench_now_ns();
+    ep_message_t *msg;
+    ep_notify_t *body;
+    mock_sub_t *sub;
+    unsigned i, k, inst, param;
+
+    for (i = 0; i < MOCK_MAX_SUBS; i++)
+    {
+        sub = &subs[i];
+        if (sub->id == 0 || !sub->has_dirty || now - sub->sent_ns < sub->min_interval_ns)
+            continue;
+
+        if ((msg = mmx_msgpool_get()) == NULL)
+            return;
+        body = &msg->body.notify;
+        init_notify(msg, sub);
+
+        for (inst = 1; inst <= versioned; inst++)
+        {
+            if (!sub->dirty[inst - 1])
+                continue;
+            sub->dirty[inst - 1] = 0;
+
+            for (k = 0; k < sub->count; k++)
+            {
+                if (inst < sub->ranges[k].first_inst || inst > sub->ranges[k].last_inst)
+                    continue;
+
+                for (param = sub->ranges[k].first_param; param <= sub->ranges[k].last_param; param++)
+                {
+                    snprintf(name, sizeof(name), MOCK_OBJ_PATH "%u.Param%u", inst, param);
+                    make_value(inst, param, value, sizeof(value));
+                    mmx_frontapi_msgstruct_insert_nvpair(msg, &body->paramValues[body->arraySize],
+                                                         name, value);
+                    if (++body->arraySize == cfg.frag_pairs)
+                    {
+                        send_response(msg);
+                        stats.notifications++;
+                        init_notify(msg, sub);
+                    }
+                }
+            }
+        }
+        if (body->arraySize)
+        {
+            send_response(msg);
+            stats.notifications++;
+        }
+
+        mmx_msgpool_put(msg);
+        sub->has_dirty = 0;
+        sub->sent_ns = now;
+    }
+}
+
+static void handle_request(const char *xml)
+{
+    if (mmx_frontapi_message_parse(xml, req) != FA_OK)
+    {
+        stats.bad++;
+        return;
+    }
+
+    switch (req->header.msgType)
+    {
+    case MSGTYPE_GETVALUE:
+        handle_getvalue();
+        break;
+
+    case MSGTYPE_GETPARAMNAMES:
+        handle_getparamnames();
+        break;
+
+    case MSGTYPE_SETVALUE:
+        init_response(MSGTYPE_SETVALUE_RESP, MMX_API_RC_OK);
+        resp->body.setParamValueResponse.status = 0;
+        send_response(resp);
+        break;
+
+    case MSGTYPE_ADDOBJECT:
+        init_response(MSGTYPE_ADDOBJECT_RESP, MMX_API_RC_OK);
+        resp->body.addObjectResponse.instanceNumber = ++cfg.instances;
+        resp->body.addObjectResponse.status = 0;
+        send_response(resp);
+        break;
+
+    case MSGTYPE_DELOBJECT:
+        init_response(MSGTYPE_DELOBJECT_RESP, MMX_API_RC_OK);
+        resp->body.delObjectResponse.status = 0;
+        send_response(resp);
+        break;
+
+    case MSGTYPE_DISCOVERCONFIG:
+        init_response(MSGTYPE_DISCOVERCONFIG_RESP, MMX_API_RC_OK);
+        send_response(resp);
+        break;
+
+    case MSGTYPE_SUBSCRIBE:
+        handle_subscribe();
+        break;
+
+    case MSGTYPE_UNSUBSCRIBE:
+        handle_unsubscribe();
+        break;
+
+    default:
+        /* Reboot, FactoryReset, InitActions - no response */
+        break;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    char buf[MMXFA_MAX_DATAGRAM_SIZE];
+    ep_packet_t *packet = (ep_packet_t *)buf;
+    unsigned seed = 1;
+    struct timeval tv;
+    uint64_t wait_ns, published_ns = 0, change_ns = 0, now = 0;
+    mmx_msgpool_stats_t pool_stats;
+    fd_set fds;
+    ssize_t res;
+    unsigned i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "p:n:k:v:f:s:l:L:S:u:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'p': cfg.port = (in_port_t)atoi(optarg); break;
+        case 'n': cfg.instances = (unsigned)atoi(optarg); break;
+        case 'k': cfg.params = (unsigned)atoi(optarg); break;
+        case 'v': cfg.value_len = (unsigned)atoi(optarg); break;
+        case 'f': cfg.frag_pairs = (unsigned)atoi(optarg); break;
+        case 's': cfg.max_dgram = (unsigned)atoi(optarg); break;
+        case 'l': cfg.latency_us = (unsigned)atoi(optarg); break;
+        case 'L': cfg.loss_pct = (unsigned)atoi(optarg); break;
+        case 'S': cfg.snapshot = optarg; break;
+        case 'u': cfg.change_us = (unsigned)atoi(optarg); break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (cfg.value_len >= MSG_MAX_STR_LEN * 4)
+        cfg.value_len = MSG_MAX_STR_LEN * 4 - 1;
+    /* Fragment must fit into a datagram */
+    if (cfg.frag_pairs == 0 || cfg.frag_pairs > MAX_NUMBER_OF_RESPONSE_VALUES)
+        cfg.frag_pairs = MAX_NUMBER_OF_RESPONSE_VALUES;
+    if (cfg.max_dgram < MOCK_HDR_SIZE + MOCK_PAIR_SIZE || cfg.max_dgram > MMXFA_MAX_DATAGRAM_SIZE)
+        cfg.max_dgram = MMXFA_MAX_DATAGRAM_SIZE;
+    if (cfg.frag_pairs > (cfg.max_dgram - MOCK_HDR_SIZE) / (MOCK_PAIR_SIZE + cfg.value_len))
+        cfg.frag_pairs = (cfg.max_dgram - MOCK_HDR_SIZE) / (MOCK_PAIR_SIZE + cfg.value_len);
+    if (cfg.frag_pairs == 0)
+        cfg.frag_pairs = 1;
+
+    if (udp_socket_init(&sock, MMX_EP_ADDR, cfg.port))
+    {
+        perror("mock-ep: could not initialize socket");
+        return 1;
+    }
+
+    /* Request and response */
+    if (mmx_msgpool_thread_init(2, MMXFA_MAX_DATAGRAM_SIZE) != FA_OK)
+    {
+        fprintf(stderr, "mock-ep: could not create message pool\n");
+        return 1;
+    }
+
+    first_version = last_version = (uint32_t)(time(NULL) % 100000) * 10000 + 1;
+    if (cfg.change_us)
+    {
+        versioned = cfg.instances;
+        versions = calloc(versioned, sizeof(*versions));
+        changed_at = calloc(versioned, sizeof(*changed_at));
+        if (versions == NULL || changed_at == NULL)
+        {
+            fprintf(stderr, "mock-ep: not enough memory\n");
+            return 1;
+        }
+        change_ns = mmx_bench_now_ns() + (uint64_t)cfg.change_us * 1000;
+    }
+
+    if (cfg.snapshot && mmx_snapshot_create(&snapshot, cfg.snapshot, cfg.instances * cfg.params * 2,
+                                            MSG_MAX_STR_LEN * 4) != FA_OK)
+    {
+        fprintf(stderr, "mock-ep: could not create snapshot file %s\n", cfg.snapshot);
+        return 1;
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    printf("mock-ep: port %u, %u instances x %u params, value %u bytes, "
+           "%u pairs/fragment (max %u bytes), latency %u us, loss %u%%\n",
+           cfg.port, cfg.instances, cfg.params, cfg.value_len,
+           cfg.frag_pairs, cfg.max_dgram, cfg.latency_us, cfg.loss_pct);
+    fflush(stdout);
+
+    while (!stop)
+    {
+        if (cfg.snapshot && mmx_bench_now_ns() - published_ns >= 1000000000ULL)
+        {
+            publish_snapshot();
+            published_ns = mmx_bench_now_ns();
+        }
+
+        if (versioned)
+        {
+            for (now = mmx_bench_now_ns(); now >= change_ns; change_ns += (uint64_t)cfg.change_us * 1000)
+                change_values();
+            send_notifications();
+        }
+
+        wait_ns = flush_pending();
+        if (versioned && (wait_ns == 0 || wait_ns > change_ns - now))
+            wait_ns = change_ns - now;
+
+        FD_ZERO(&fds);
+        FD_SET(sock, &fds);
+        tv.tv_sec = wait_ns ? (time_t)(wait_ns / 1000000000ULL) : 1;
+        tv.tv_usec = wait_ns ? (suseconds_t)((wait_ns % 1000000000ULL) / 1000) : 0;
+
+        res = select(sock + 1, &fds, NULL, NULL, &tv);
+        if (res < 0 && errno != EINTR)
+        {
+            perror("mock-ep: select");
+            break;
+        }
+        if (res <= 0)
+            continue;
+
+        res = recv(sock, buf, sizeof(buf) - 1, 0);
+        if (res <= (ssize_t)sizeof(ep_packet_t))
+            continue;
+        buf[res] = '\0';
+        stats.requests++;
+
+        if (cfg.loss_pct && (unsigned)(rand_r(&seed) % 100) < cfg.loss_pct)
+        {
+            stats.dropped++;
+            continue;
+        }
+
+        req = mmx_msgpool_get();
+        resp = mmx_msgpool_get();
+        if (req && resp)
+            handle_request(packet->msg);
+        else
+            stats.bad++;
+        if (req)
+            mmx_msgpool_put(req);
+        if (resp)
+            mmx_msgpool_put(resp);
+    }
+
+    printf("mock-ep: requests %lu, responses %lu, dropped %lu, bad %lu, oversize %lu\n",
+           stats.requests, stats.responses, stats.dropped, stats.bad, stats.oversize);
+    if (versioned)
+        printf("mock-ep: value changes %lu, notifications %lu\n", stats.changes, stats.notifications);
+    if (stats.deltas || stats.not_modified)
+        printf("mock-ep: delta responses %lu, not modified %lu\n", stats.deltas, stats.not_modified);
+    if (mmx_msgpool_stats(&pool_stats) == FA_OK)
+        printf("mock-ep: message pool - max used values %u of %u bytes\n",
+               pool_stats.max_value_bytes, pool_stats.value_pool_size);
+    mmx_msgpool_thread_destroy();
+    for (i = 0; i < MOCK_MAX_SUBS; i++)
+        free(subs[i].dirty);
+    free(versions);
+    free(changed_at);
+    if (cfg.snapshot)
+        mmx_snapshot_close(&snapshot);
+    close(sock);
+
+    return 0;
+}
@@ -0,0 +1,771 @@
+/* mmx-msgbench.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Microbenchmark of the message parser and serializer:
+ * mmx_frontapi_message_build, mmx_frontapi_message_parse,
+ * mmx_frontapi_msg_header_parse and the lazy parser
+ * (mmx_frontapi_message_parse_lazy alone - "lazy", and with all
+ * name-value pairs iterated - "lazynv").
+ *
+ * The built-in corpus covers every message type with a range of array
+ * sizes, short and long values and values with characters that must be
+ * escaped in XML. Messages captured from a real system (XML files, one
+ * message per file) may be added to the corpus as arguments.
+ *
+ * For every message and operation it reports ns/message, MB/s of XML and
+ * heap allocations per call. Results may be written as JSON lines (-j) and
+ * compared against such a file from a previous run (-b).
+ *
+ * Usage: mmx-msgbench [-t min_ms] [-f filter] [-j] [-b baseline.json [-r max_regression_pct]]
+ *                     [message.xml ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-lazy.h"
+#include "mmx-bench.h"
+
+#define MSGBENCH_POOL_SIZE      65535   /* max size of message memory pool */
+#define MSGBENCH_XML_SIZE       (256 * 1024)
+#define MSGBENCH_MAX_CASES      128
+#define MSGBENCH_MAX_BASELINE   1024
+#define MSGBENCH_WARMUP         16
+#define MSGBENCH_MIN_ITERS      32
+
+#define MSGBENCH_SHORT_VALUE    8
+#define MSGBENCH_LONG_VALUE     (MSG_MAX_STR_LEN * 4 - 1)
+
+typedef enum msgbench_op_e {
+    MSGBENCH_OP_BUILD = 0,
+    MSGBENCH_OP_PARSE,
+    MSGBENCH_OP_HEADER,
+    MSGBENCH_OP_LAZY,
+    MSGBENCH_OP_LAZY_NVPAIRS,
+    MSGBENCH_OP_LAST
+} msgbench_op_t;
+
+static const char *op_names[MSGBENCH_OP_LAST] = {"build", "parse", "header", "lazy", "lazynv"};
+
+/* Message of the corpus */
+typedef struct msgbench_case_s {
+    char name[64];
+    msgtype_t type;
+    unsigned count;         /* size of the body array */
+    unsigned value_len;
+    int escaped;            /* values contain characters escaped in XML */
+    char *xml;              /* built (or loaded) message */
+    size_t xml_len;
+} msgbench_case_t;
+
+typedef struct msgbench_result_s {
+    double ns;              /* mean time per call */
+    double mbps;            /* MB of XML per second */
+    double allocs;          /* heap allocations per call, < 0 - not counted */
+    unsigned long iters;
+} msgbench_result_t;
+
+typedef struct msgbench_baseline_s {
+    char name[64];
+    char op[16];
+    double ns;
+} msgbench_baseline_t;
+
+static msgbench_case_t cases[MSGBENCH_MAX_CASES];
+static unsigned cases_count;
+
+static msgbench_baseline_t baseline[MSGBENCH_MAX_BASELINE];
+static unsigned baseline_count;
+
+static ep_message_t msg;
+static char pool[MSGBENCH_POOL_SIZE];
+static char xml_buf[MSGBENCH_XML_SIZE];
+
+static unsigned min_ms = 200;
+
+/*
+ * Heap allocations are counted by interposing malloc family of glibc:
+ * calls made by the library and microxml are resolved to these functions.
+ */
+static volatile unsigned long alloc_calls;
+static volatile int alloc_counting;
+
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+void *malloc(size_t size)
+{
+    if (alloc_counting)
+        alloc_calls++;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+    if (alloc_counting)
+        alloc_calls++;
+    return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    if (alloc_counting)
+        alloc_calls++;
+    return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr)
+{
+    __libc_free(ptr);
+}
+#define MSGBENCH_ALLOCS_COUNTED 1
+#else
+#define MSGBENCH_ALLOCS_COUNTED 0
+#endif
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-t min_ms] [-f filter] [-j] [-b baseline.json [-r max_regression_pct]]\n"
+                    "          [message.xml ...]\n", prog);
+}
+
+static void make_name(unsigned idx, char *buf, size_t size)
+{
+    snprintf(buf, size, "Device.Bench.Obj.%u.Param%u", idx / 8 + 1, idx % 8 + 1);
+}
+
+static void make_value(const msgbench_case_t *c, unsigned idx, char *buf, size_t size)
+{
+    static const char escaped[] = "<a&b>\"c'";
+    size_t len = snprintf(buf, size, "v%u-", idx);
+
+    while (len < c->value_len && len < size - 1)
+    {
+        buf[len] = c->escaped ? escaped[len % (sizeof(escaped) - 1)] : 'x';
+        len++;
+    }
+    buf[len] = '\0';
+}
+
+static void msg_init(ep_message_t *m)
+{
+    memset(&m->header, 0, sizeof(m->header));
+    memset(&m->body, 0, sizeof(m->body));
+    mmx_frontapi_msg_struct_init(m, pool, sizeof(pool));
+}
+
+/* Fills the message structure of the corpus case */
+static int fill_message(const msgbench_case_t *c, ep_message_t *m)
+{
+    char name[NVP_MAX_NAME_LEN], value[MSGBENCH_LONG_VALUE + 1];
+    unsigned i;
+    int res = FA_OK;
+
+    msg_init(m);
+    m->header.callerId = MMX_API_CALLERID_CLI;
+    m->header.txaId = 123456;
+    m->header.respMode = MMX_API_RESPMODE_SYNC;
+    m->header.respIpAddr = htonl(INADDR_LOOPBACK);
+    m->header.respPort = 10199;
+    m->header.msgType = c->type;
+
+    switch (c->type)
+    {
+    case MSGTYPE_GETVALUE:
+        m->body.getParamValue.arraySize = c->count;
+        for (i = 0; i < c->count; i++)
+            make_name(i, m->body.getParamValue.paramNames[i], NVP_MAX_NAME_LEN);
+        break;
+
+    case MSGTYPE_GETVALUE_RESP:
+        m->header.respFlag = 1;
+        m->body.getParamValueResponse.arraySize = c->count;
+        for (i = 0; i < c->count && res == FA_OK; i++)
+        {
+            make_name(i, name, sizeof(name));
+            make_value(c, i, value, sizeof(value));
+            res = mmx_frontapi_msgstruct_insert_nvpair(m, &m->body.getParamValueResponse.paramValues[i],
+                                                       name, value);
+        }
+        break;
+
+    case MSGTYPE_SETVALUE:
+        m->body.setParamValue.arraySize = c->count;
+        for (i = 0; i < c->count && res == FA_OK; i++)
+        {
+            make_name(i, name, sizeof(name));
+            make_value(c, i, value, sizeof(value));
+            res = mmx_frontapi_msgstruct_insert_nvpair(m, &m->body.setParamValue.paramValues[i],
+                                                       name, value);
+        }
+        break;
+
+    case MSGTYPE_SETVALUE_RESP:
+        /* Response with faults if count is set */
+        m->header.respFlag = 1;
+        if (c->count == 0)
+            break;
+        m->header.respCode = MMX_API_RC_INVALID_PARAM_VALUE;
+        m->body.setParamValueFaultResponse.arraySize = c->count;
+        for (i = 0; i < c->count; i++)
+        {
+            make_name(i, m->body.setParamValueFaultResponse.paramFaults[i].name, MSG_MAX_STR_LEN);
+            m->body.setParamValueFaultResponse.paramFaults[i].faultcode = MMX_API_RC_INVALID_PARAM_VALUE;
+        }
+        break;
+
+    case MSGTYPE_GETPARAMNAMES:
+        strcpy_safe(m->body.getParamNames.pathName, "Device.Bench.Obj.", MSG_MAX_STR_LEN);
+        m->body.getParamNames.nextLevel = 1;
+        break;
+
+    case MSGTYPE_GETPARAMNAMES_RESP:
+        m->header.respFlag = 1;
+        m->body.getParamNamesResponse.arraySize = c->count;
+        for (i = 0; i < c->count; i++)
+        {
+            make_name(i, m->body.getParamNamesResponse.paramInfo[i].name, NVP_MAX_NAME_LEN);
+            m->body.getParamNamesResponse.paramInfo[i].writable = '1';
+        }
+        break;
+
+    case MSGTYPE_ADDOBJECT:
+        strcpy_safe(m->body.addObject.objName, "Device.Bench.Obj.", MSG_MAX_STR_LEN);
+        m->body.addObject.arraySize = c->count;
+        for (i = 0; i < c->count && res == FA_OK; i++)
+        {
+            snprintf(name, sizeof(name), "Param%u", i + 1);
+            make_value(c, i, value, sizeof(value));
+            res = mmx_frontapi_msgstruct_insert_nvpair(m, &m->body.addObject.paramValues[i],
+                                                       name, value);
+        }
+        break;
+
+    case MSGTYPE_ADDOBJECT_RESP:
+        m->header.respFlag = 1;
+        m->body.addObjectResponse.instanceNumber = 42;
+        break;
+
+    case MSGTYPE_DELOBJECT:
+        m->body.delObject.arraySize = c->count;
+        for (i = 0; i < c->count; i++)
+            snprintf(m->body.delObject.objects[i], MSG_MAX_STR_LEN, "Device.Bench.Obj.%u.", i + 1);
+        break;
+
+    case MSGTYPE_DELOBJECT_RESP:
+    case MSGTYPE_DISCOVERCONFIG_RESP:
+        m->header.respFlag = 1;
+        break;
+
+    case MSGTYPE_DISCOVERCONFIG:
+        strcpy_safe(m->body.discoverConfig.backendName, "bench-backend", MSG_MAX_STR_LEN);
+        strcpy_safe(m->body.discoverConfig.objName, "Device.Bench.", MSG_MAX_STR_LEN);
+        break;
+
+    case MSGTYPE_REBOOT:
+        m->body.reboot.delaySeconds = 5;
+        break;
+
+    case MSGTYPE_RESET:
+        m->body.reset.delaySeconds = 5;
+        m->body.reset.resetType = 1;
+        break;
+
+    case MSGTYPE_SUBSCRIBE:
+        m->body.subscribe.minInterval = 100;
+        m->body.subscribe.arraySize = c->count;
+        for (i = 0; i < c->count; i++)
+            make_name(i, m->body.subscribe.paramNames[i], NVP_MAX_NAME_LEN);
+        break;
+
+    case MSGTYPE_SUBSCRIBE_RESP:
+        m->header.respFlag = 1;
+        m->body.subscribeResponse.subscriptionId = 42;
+        break;
+
+    case MSGTYPE_UNSUBSCRIBE:
+        m->body.unsubscribe.subscriptionId = 42;
+        break;
+
+    case MSGTYPE_UNSUBSCRIBE_RESP:
+        m->header.respFlag = 1;
+        break;
+
+    case MSGTYPE_NOTIFY:
+        m->header.txaId = 0;
+        m->body.notify.subscriptionId = 42;
+        m->body.notify.arraySize = c->count;
+        for (i = 0; i < c->count && res == FA_OK; i++)
+        {
+            make_name(i, name, sizeof(name));
+            make_value(c, i, value, sizeof(value));
+            res = mmx_frontapi_msgstruct_insert_nvpair(m, &m->body.notify.paramValues[i],
+                                                       name, value);
+        }
+        break;
+
+    default:
+        return FA_GENERAL_ERROR;
+    }
+
+    return res;
+}
+
+static void add_case(msgtype_t type, unsigned count, unsigned value_len, int escaped)
+{
+    msgbench_case_t *c;
+
+    if (cases_count == MSGBENCH_MAX_CASES)
+        return;
+
+    c = &cases[cases_count++];
+    c->type = type;
+    c->count = count;
+    c->value_len = value_len;
+    c->escaped = escaped;
+    snprintf(c->name, sizeof(c->name), "%s/n%u/v%u%s", msgtype2str(type), count, value_len,
+             escaped ? "/esc" : "");
+}
+
+/* Built-in corpus: every message type, array sizes from 1 to the maximum */
+static void make_corpus(void)
+{
+    static const unsigned gpv_sizes[] = {1, 8, 32, MAX_NUMBER_OF_RESPONSE_VALUES};
+    unsigned i;
+
+    add_case(MSGTYPE_GETVALUE, 1, 0, 0);
+    add_case(MSGTYPE_GETVALUE, MSG_MAX_NUMBER_OF_GET_PARAMS, 0, 0);
+
+    for (i = 0; i < sizeof(gpv_sizes) / sizeof(gpv_sizes[0]); i++)
+        add_case(MSGTYPE_GETVALUE_RESP, gpv_sizes[i], MSGBENCH_SHORT_VALUE, 0);
+    add_case(MSGTYPE_GETVALUE_RESP, 32, MSGBENCH_LONG_VALUE, 0);
+    add_case(MSGTYPE_GETVALUE_RESP, 32, MSGBENCH_SHORT_VALUE * 4, 1);
+
+    add_case(MSGTYPE_SETVALUE, 1, MSGBENCH_SHORT_VALUE, 0);
+    add_case(MSGTYPE_SETVALUE, MSG_MAX_NUMBER_OF_SET_PARAMS, MSGBENCH_SHORT_VALUE, 0);
+    add_case(MSGTYPE_SETVALUE, MSG_MAX_NUMBER_OF_SET_PARAMS, MSGBENCH_LONG_VALUE, 1);
+
+    add_case(MSGTYPE_SETVALUE_RESP, 0, 0, 0);
+    add_case(MSGTYPE_SETVALUE_RESP, MSG_MAX_NUMBER_OF_SET_PARAMS, 0, 0);
+
+    add_case(MSGTYPE_GETPARAMNAMES, 0, 0, 0);
+    add_case(MSGTYPE_GETPARAMNAMES_RESP, 8, 0, 0);
+    add_case(MSGTYPE_GETPARAMNAMES_RESP, MAX_NUMBER_OF_GPN_RESPONSE_VALUES, 0, 0);
+
+    add_case(MSGTYPE_ADDOBJECT, 0, 0, 0);
+    add_case(MSGTYPE_ADDOBJECT, MSG_MAX_NUMBER_OF_ADDOBJ_PARAMS, MSGBENCH_SHORT_VALUE, 0);
+    add_case(MSGTYPE_ADDOBJECT_RESP, 0, 0, 0);
+
+    add_case(MSGTYPE_DELOBJECT, 1, 0, 0);
+    add_case(MSGTYPE_DELOBJECT, MSG_MAX_NUMBER_OF_DELOBJ_PARAMS, 0, 0);
+    add_case(MSGTYPE_DELOBJECT_RESP, 0, 0, 0);
+
+    add_case(MSGTYPE_DISCOVERCONFIG, 0, 0, 0);
+    add_case(MSGTYPE_DISCOVERCONFIG_RESP, 0, 0, 0);
+    add_case(MSGTYPE_INITACTIONS, 0, 0, 0);
+    add_case(MSGTYPE_REBOOT, 0, 0, 0);
+    add_case(MSGTYPE_RESET, 0, 0, 0);
+
+    add_case(MSGTYPE_SUBSCRIBE, MSG_MAX_NUMBER_OF_GET_PARAMS, 0, 0);
+    add_case(MSGTYPE_SUBSCRIBE_RESP, 0, 0, 0);
+    add_case(MSGTYPE_UNSUBSCRIBE, 0, 0, 0);
+    add_case(MSGTYPE_UNSUBSCRIBE_RESP, 0, 0, 0);
+    add_case(MSGTYPE_NOTIFY, 1, MSGBENCH_SHORT_VALUE, 0);
+    add_case(MSGTYPE_NOTIFY, 32, MSGBENCH_SHORT_VALUE, 0);
+}
+
+/* Builds XML of the corpus case (parse-only cases are made of others) */
+static int build_case(msgbench_case_t *c)
+{
+    msgbench_case_t tmp;
+    const char *from, *to;
+    char *pos;
+    size_t len;
+
+    if (c->type != MSGTYPE_INITACTIONS)
+    {
+        if (fill_message(c, &msg) != FA_OK ||
+            mmx_frontapi_message_build(&msg, xml_buf, sizeof(xml_buf)) != FA_OK)
+            return FA_GENERAL_ERROR;
+    }
+    else
+    {
+        /* InitActions cannot be built: it has no body, as DiscoverConfigResponse */
+        memset(&tmp, 0, sizeof(tmp));
+        tmp.type = MSGTYPE_DISCOVERCONFIG_RESP;
+        if (fill_message(&tmp, &msg) != FA_OK ||
+            mmx_frontapi_message_build(&msg, xml_buf, sizeof(xml_buf)) != FA_OK)
+            return FA_GENERAL_ERROR;
+
+        from = msgtype2str(MSGTYPE_DISCOVERCONFIG_RESP);
+        to = msgtype2str(MSGTYPE_INITACTIONS);
+        if ((pos = strstr(xml_buf, from)) == NULL)
+            return FA_GENERAL_ERROR;
+        len = strlen(pos + strlen(from));
+        memmove(pos + strlen(to), pos + strlen(from), len + 1);
+        memcpy(pos, to, strlen(to));
+    }
+
+    c->xml_len = strlen(xml_buf);
+    if ((c->xml = strdup(xml_buf)) == NULL)
+        return FA_NOT_ENOUGH_MEMORY;
+
+    return FA_OK;
+}
+
+/* Adds captured message from the file to the corpus */
+static int load_case(const char *path)
+{
+    msgbench_case_t *c;
+    const char *base;
+    FILE *f;
+    size_t len;
+
+    if (cases_count == MSGBENCH_MAX_CASES)
+        return FA_NOT_ENOUGH_MEMORY;
+
+    if ((f = fopen(path, "r")) == NULL)
+    {
+        perror(path);
+        return FA_GENERAL_ERROR;
+    }
+    len = fread(xml_buf, 1, sizeof(xml_buf) - 1, f);
+    fclose(f);
+    xml_buf[len] = '\0';
+
+    /* Captured requests may start with the flags of ep_packet_t */
+    base = memchr(xml_buf, '<', len);
+    if (base == NULL)
+    {
+        fprintf(stderr, "%s: not an XML message\n", path);
+        return FA_INVALID_FORMAT;
+    }
+
+    c = &cases[cases_count];
+    memset(c, 0, sizeof(*c));
+    if ((c->xml = strdup(base)) == NULL)
+        return FA_NOT_ENOUGH_MEMORY;
+    c->xml_len = strlen(c->xml);
+
+    msg_init(&msg);
+    if (mmx_frontapi_message_parse(c->xml, &msg) != FA_OK)
+    {
+        fprintf(stderr, "%s: could not parse message\n", path);
+        free(c->xml);
+        return FA_INVALID_FORMAT;
+    }
+    c->type = msg.header.msgType;
+
+    base = strrchr(path, '/');
+    snprintf(c->name, sizeof(c->name), "file:%s", base ? base + 1 : path);
+    cases_count++;
+
+    return FA_OK;
+}
+
+/* One call of the operation; only the call itself is timed */
+static int run_once(const msgbench_case_t *c, msgbench_op_t op, ep_message_t *parsed, uint64_t *ns)
+{
+    ep_msg_header_t hdr;
+    mmx_lazy_msg_t lazy;
+    mmx_lazy_iter_t it;
+    uint64_t start;
+    int res;
+
+    switch (op)
+    {
+    case MSGBENCH_OP_BUILD:
+        start = mmx_bench_now_ns();
+        res = mmx_frontapi_message_build(parsed, xml_buf, sizeof(xml_buf));
+        break;
+
+    case MSGBENCH_OP_PARSE:
+        memset(&msg.header, 0, sizeof(msg.header));
+        mmx_frontapi_msg_struct_init(&msg, pool, sizeof(pool));
+        start = mmx_bench_now_ns();
+        res = mmx_frontapi_message_parse(c->xml, &msg);
+        break;
+
+    case MSGBENCH_OP_HEADER:
+        memset(&hdr, 0, sizeof(hdr));
+        start = mmx_bench_now_ns();
+        res = mmx_frontapi_msg_header_parse(c->xml, &hdr);
+        break;
+
+    case MSGBENCH_OP_LAZY:
+    case MSGBENCH_OP_LAZY_NVPAIRS:
+        start = mmx_bench_now_ns();
+        res = mmx_frontapi_message_parse_lazy(c->xml, &lazy, NULL);
+        if (res == FA_OK && op == MSGBENCH_OP_LAZY_NVPAIRS)
+        {
+            mmx_lazy_nvpair_iter_init(&lazy, &it, pool, sizeof(pool));
+            while (mmx_lazy_nvpair_next(&it) != NULL)
+                ;
+            res = it.status;
+        }
+        break;
+
+    default:
+        return FA_GENERAL_ERROR;
+    }
+
+    *ns = mmx_bench_now_ns() - start;
+    return res;
+}
+
+static int run_op(const msgbench_case_t *c, msgbench_op_t op, msgbench_result_t *r)
+{
+    static ep_message_t parsed;
+    static char parsed_pool[MSGBENCH_POOL_SIZE];
+    uint64_t ns, total_ns = 0, allocs = 0, deadline;
+    unsigned long i;
+
+    /* Name-value pairs are iterated in the messages that have them */
+    if (op == MSGBENCH_OP_LAZY_NVPAIRS && c->type != MSGTYPE_GETVALUE_RESP &&
+        c->type != MSGTYPE_SETVALUE && c->type != MSGTYPE_ADDOBJECT)
+        return FA_BAD_INPUT_PARAMS;
+
+    /* Messages are built from the structure the corpus XML is parsed to */
+    if (op == MSGBENCH_OP_BUILD)
+    {
+        if (c->type == MSGTYPE_INITACTIONS)
+            return FA_BAD_INPUT_PARAMS;
+        memset(&parsed.header, 0, sizeof(parsed.header));
+        memset(&parsed.body, 0, sizeof(parsed.body));
+        mmx_frontapi_msg_struct_init(&parsed, parsed_pool, sizeof(parsed_pool));
+        if (mmx_frontapi_message_parse(c->xml, &parsed) != FA_OK)
+            return FA_INVALID_FORMAT;
+    }
+
+    for (i = 0; i < MSGBENCH_WARMUP; i++)
+    {
+        if (run_once(c, op, &parsed, &ns) != FA_OK)
+            return FA_GENERAL_ERROR;
+    }
+
+    deadline = mmx_bench_now_ns() + (uint64_t)min_ms * 1000000;
+    for (i = 0; i < MSGBENCH_MIN_ITERS || mmx_bench_now_ns() < deadline; i++)
+    {
+        alloc_calls = 0;
+        alloc_counting = 1;
+        run_once(c, op, &parsed, &ns);
+        alloc_counting = 0;
+
+        allocs += alloc_calls;
+        total_ns += ns;
+    }
+
+    r->iters = i;
+    r->ns = (double)total_ns / i;
+    r->mbps = r->ns > 0 ? c->xml_len * 1e3 / r->ns : 0;
+    r->allocs = MSGBENCH_ALLOCS_COUNTED ? (double)allocs / i : -1;
+
+    return FA_OK;
+}
+
+/* Reads results of previous run written with -j */
+static int load_baseline(const char *path)
+{
+    char line[512];
+    msgbench_baseline_t *b;
+    FILE *f;
+
+    if ((f = fopen(path, "r")) == NULL)
+    {
+        perror(path);
+        return FA_GENERAL_ERROR;
+    }
+
+    while (baseline_count < MSGBENCH_MAX_BASELINE && fgets(line, sizeof(line), f))
+    {
+        b = &baseline[baseline_count];
+        if (sscanf(line, "{\"case\": \"%63[^\"]\", \"op\": \"%15[^\"]\", \"ns_per_msg\": %lf",
+                   b->name, b->op, &b->ns) == 3)
+            baseline_count++;
+    }
+    fclose(f);
+
+    return FA_OK;
+}
+
+static const msgbench_baseline_t *find_baseline(const char *name, const char *op)
+{
+    unsigned i;
+
+    for (i = 0; i < baseline_count; i++)
+    {
+        if (!strcmp(baseline[i].name, name) && !strcmp(baseline[i].op, op))
+            return &baseline[i];
+    }
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *filter = NULL, *baseline_path = NULL;
+    const msgbench_baseline_t *b;
+    msgbench_result_t r;
+    double max_regression = 5.0, delta;
+    unsigned i, regressions = 0;
+    int opt, json = 0, op;
+
+    while ((opt = getopt(argc, argv, "t:f:jb:r:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 't': min_ms = (unsigned)atoi(optarg); break;
+        case 'f': filter = optarg; break;
+        case 'j': json = 1; break;
+        case 'b': baseline_path = optarg; break;
+        case 'r': max_regression = atof(optarg); break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (baseline_path && load_baseline(baseline_path) != FA_OK)
+        return 1;
+
+    make_corpus();
+    for (i = 0; i < cases_count; i++)
+    {
+        if (build_case(&cases[i]) != FA_OK)
+        {
+            fprintf(stderr, "msgbench: could not build %s\n", cases[i].name);
+            return 1;
+        }
+    }
+    for (; optind < argc; optind++)
+    {
+        if (load_case(argv[optind]) != FA_OK)
+            return 1;
+    }
+
+    if (!json)
+        printf("%-44s %-6s %7s %10s %8s %8s %s\n",
+               "message", "op", "bytes", "ns/msg", "MB/s", "allocs", baseline_count ? "vs baseline" : "");
+
+    for (i = 0; i < cases_count; i++)
+    {
+        if (filter && !strstr(cases[i].name, filter))
+            continue;
+
+        for (op = 0; op < MSGBENCH_OP_LAST; op++)
+        {
+            if (run_op(&cases[i], op, &r) != FA_OK)
+                continue;
+
+            b = find_baseline(cases[i].name, op_names[op]);
+            delta = (b && b->ns > 0) ? (r.ns - b->ns) * 100 / b->ns : 0;
+            if (b && delta > max_regression)
+                regressions++;
+
+            if (json)
+            {
+                printf("{\"case\": \"%s\", \"op\": \"%s\", \"ns_per_msg\": %.1f, \"bytes\": %zu, "
+                       "\"mb_per_s\": %.2f, \"allocs_per_call\": %.2f, \"iters\": %lu",
+                       cases[i].name, op_names[op], r.ns, cases[i].xml_len, r.mbps, r.allocs, r.iters);
+                if (b)
+                    printf(", \"baseline_ns\": %.1f, \"delta_pct\": %.1f", b->ns, delta);
+                printf("}\n");
+            }
+            else
+            {
+                printf("%-44s %-6s %7zu %10.0f %8.1f ", cases[i].name, op_names[op],
+                       cases[i].xml_len, r.ns, r.mbps);
+                if (r.allocs >= 0)
+                    printf("%8.1f", r.allocs);
+                else
+                    printf("%8s", "n/a");
+                if (b)
+                    printf(" %+6.1f%%%s", delta, delta > max_regression ? " REGRESSION" : "");
+                printf("\n");
+            }
+        }
+    }
+
+    for (i = 0; i < cases_count; i++)
+        free(cases[i].xml);
+
+    if (regressions)
+    {
+        fprintf(stderr, "msgbench: %u results are more than %.1f%% slower than baseline\n",
+                regressions, max_regression);
+        return 3;
+    }
+    return 0;
+}
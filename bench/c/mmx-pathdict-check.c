@@ -0,0 +1,276 @@
+/* mmx-pathdict-check.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Round-trip check of the path dictionary (see mmx-frontapi-pathdict.h):
+ * a client and an Entry-point exchange GetParamNames and GetParamValue
+ * messages built and parsed with their dictionaries, including a lost
+ * GetParamNames response, a new client and a client without dictionary,
+ * also with the Entry-point parsing requests lazily (mmx-frontapi-lazy.h).
+ * Every step must restore the names; responses may be encoded only with
+ * Ids the client has received.
+ *
+ * Usage: mmx-pathdict-check
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-pathdict.h"
+#include "mmx-frontapi-lazy.h"
+
+#define CHECK_POOL_SIZE     4096
+#define CHECK_XML_SIZE      (16 * 1024)
+#define CHECK_EP_GENERATION 0x5eed
+
+#define CHECK_OBJ_PATH      "Device.Bench.Obj.1."
+#define CHECK_PARAM_NAME    CHECK_OBJ_PATH "Param1"
+#define CHECK_PARAM_VALUE   "value1"
+
+static mmx_path_dict_t ep_dict, client_dict;
+static char ep_strings[4096], client_strings[4096];
+static char pool[CHECK_POOL_SIZE];
+static char xml[CHECK_XML_SIZE];
+static ep_message_t req, resp;
+static int failures;
+
+static void msg_init(ep_message_t *m, msgtype_t type)
+{
+    memset(&m->header, 0, sizeof(m->header));
+    memset(&m->body, 0, sizeof(m->body));
+    mmx_frontapi_msg_struct_init(m, pool, sizeof(pool));
+    m->header.callerId = MMX_API_CALLERID_CLI;
+    m->header.txaId = 1;
+    m->header.respMode = MMX_API_RESPMODE_SYNC;
+    m->header.respIpAddr = htonl(INADDR_LOOPBACK);
+    m->header.respPort = 10199;
+    m->header.msgType = type;
+}
+
+static int fail(const char *step, const char *what)
+{
+    printf("%-44s FAILED: %s\n", step, what);
+    failures++;
+    return FA_GENERAL_ERROR;
+}
+
+/*
+ * Entry-point parses the request lazily: only the header and the
+ * name-value pairs of SetParamValue
+ */
+static int parse_lazy(const char *step, msgtype_t type, ep_msg_header_t *hdr)
+{
+    mmx_lazy_msg_t lazy;
+    mmx_lazy_iter_t it;
+    const nvpair_t *pair;
+    char value[MSG_MAX_STR_LEN];
+
+    if (mmx_frontapi_message_parse_lazy(xml, &lazy, &ep_dict) != FA_OK)
+        return fail(step, "could not parse request");
+    *hdr = lazy.header;
+    if (type != MSGTYPE_SETVALUE)
+        return FA_OK;
+
+    mmx_lazy_nvpair_iter_init(&lazy, &it, value, sizeof(value));
+    pair = mmx_lazy_nvpair_next(&it);
+    if (pair == NULL || strcmp(pair->name, CHECK_PARAM_NAME) || strcmp(pair->pValue, CHECK_PARAM_VALUE))
+        return fail(step, "wrong name-value pair in request");
+    return FA_OK;
+}
+
+/*
+ * Client sends GetParamNames, GetParamValue or SetParamValue request and
+ * the Entry-point (parsing it lazily if 'lazy' is set) answers it. The
+ * response is not parsed by the client if it is lost; SetParamValue is
+ * not answered. 'encoded' - 1/0 if the GetParamValue response must/must
+ * not use Ids.
+ */
+static int exchange(const char *step, msgtype_t type, mmx_path_dict_t *dict, int lost, int encoded,
+                    int lazy)
+{
+    ep_msg_header_t hdr;
+
+    msg_init(&req, type);
+    if (type == MSGTYPE_GETPARAMNAMES)
+    {
+        strcpy_safe(req.body.getParamNames.pathName, CHECK_OBJ_PATH, MSG_MAX_STR_LEN);
+        req.body.getParamNames.nextLevel = 1;
+    }
+    else if (type == MSGTYPE_SETVALUE)
+    {
+        req.body.setParamValue.arraySize = 1;
+        mmx_frontapi_msgstruct_insert_nvpair(&req, &req.body.setParamValue.paramValues[0],
+                                             CHECK_PARAM_NAME, CHECK_PARAM_VALUE);
+    }
+    else
+    {
+        req.body.getParamValue.arraySize = 1;
+        strcpy_safe(req.body.getParamValue.paramNames[0], CHECK_PARAM_NAME, NVP_MAX_NAME_LEN);
+    }
+    if (mmx_frontapi_message_build_ex(&req, xml, sizeof(xml), dict) != FA_OK)
+        return fail(step, "could not build request");
+
+    /* Entry-point */
+    if (lazy)
+    {
+        if (parse_lazy(step, type, &hdr) != FA_OK)
+            return FA_GENERAL_ERROR;
+    }
+    else
+    {
+        msg_init(&req, type);
+        if (mmx_frontapi_message_parse_ex(xml, &req, &ep_dict) != FA_OK)
+            return fail(step, "could not parse request");
+        if (type == MSGTYPE_GETVALUE && strcmp(req.body.getParamValue.paramNames[0], CHECK_PARAM_NAME))
+            return fail(step, "wrong name in request");
+        hdr = req.header;
+    }
+
+    if (type == MSGTYPE_SETVALUE)
+    {
+        printf("%-44s ok\n", step);
+        return FA_OK;
+    }
+    if (type == MSGTYPE_GETPARAMNAMES)
+    {
+        msg_init(&resp, MSGTYPE_GETPARAMNAMES_RESP);
+        resp.body.getParamNamesResponse.arraySize = 2;
+        strcpy_safe(resp.body.getParamNamesResponse.paramInfo[0].name, CHECK_OBJ_PATH, NVP_MAX_NAME_LEN);
+        strcpy_safe(resp.body.getParamNamesResponse.paramInfo[1].name, CHECK_PARAM_NAME, NVP_MAX_NAME_LEN);
+    }
+    else
+    {
+        msg_init(&resp, MSGTYPE_GETVALUE_RESP);
+        resp.body.getParamValueResponse.arraySize = 1;
+        mmx_frontapi_msgstruct_insert_nvpair(&resp, &resp.body.getParamValueResponse.paramValues[0],
+                                             CHECK_PARAM_NAME, CHECK_PARAM_VALUE);
+    }
+    hdr.msgType = resp.header.msgType;
+    hdr.respFlag = 1;
+    resp.header = hdr;
+    if (mmx_frontapi_message_build_ex(&resp, xml, sizeof(xml), &ep_dict) != FA_OK)
+        return fail(step, "could not build response");
+
+    if (lost)
+    {
+        printf("%-44s ok (lost)\n", step);
+        return FA_OK;
+    }
+    if (type == MSGTYPE_GETVALUE && encoded >= 0 && (strstr(xml, " pd=\"") != NULL) != encoded)
+        return fail(step, encoded ? "response is not encoded" : "response is encoded");
+
+    /* Client */
+    msg_init(&resp, hdr.msgType);
+    if (mmx_frontapi_message_parse_ex(xml, &resp, dict) != FA_OK)
+        return fail(step, "could not parse response");
+    if (type == MSGTYPE_GETPARAMNAMES &&
+        strcmp(resp.body.getParamNamesResponse.paramInfo[1].name, CHECK_PARAM_NAME))
+        return fail(step, "wrong name in response");
+    if (type == MSGTYPE_GETVALUE &&
+        (strcmp(resp.body.getParamValueResponse.paramValues[0].name, CHECK_PARAM_NAME) ||
+         strcmp(resp.body.getParamValueResponse.paramValues[0].pValue, CHECK_PARAM_VALUE)))
+        return fail(step, "wrong name-value pair in response");
+
+    printf("%-44s ok%s\n", step, (type == MSGTYPE_GETVALUE && encoded == 1) ? " (encoded)" : "");
+    return FA_OK;
+}
+
+int main(void)
+{
+    mmx_path_dict_init(&ep_dict, MMX_PATHDICT_ROLE_EP, CHECK_EP_GENERATION,
+                       ep_strings, sizeof(ep_strings));
+    mmx_path_dict_init(&client_dict, MMX_PATHDICT_ROLE_CLIENT, 0,
+                       client_strings, sizeof(client_strings));
+
+    exchange("GetParamNames, response lost", MSGTYPE_GETPARAMNAMES, &client_dict, 1, -1, 0);
+    exchange("GetParamValue of client at generation 0", MSGTYPE_GETVALUE, &client_dict, 0, 0, 0);
+    exchange("GetParamValue, no Id received", MSGTYPE_GETVALUE, &client_dict, 0, 0, 0);
+    exchange("GetParamNames, response delivered", MSGTYPE_GETPARAMNAMES, &client_dict, 0, -1, 0);
+    exchange("GetParamValue, Id received and used", MSGTYPE_GETVALUE, &client_dict, 0, 1, 0);
+    exchange("GetParamValue of client without dictionary", MSGTYPE_GETVALUE, NULL, 0, 0, 0);
+    exchange("GetParamValue, Id used again", MSGTYPE_GETVALUE, &client_dict, 0, 1, 0);
+
+    /* Client restarts and knows nothing */
+    mmx_path_dict_reset(&client_dict, 0);
+    exchange("GetParamValue of restarted client", MSGTYPE_GETVALUE, &client_dict, 0, 0, 0);
+    exchange("GetParamValue of restarted client again", MSGTYPE_GETVALUE, &client_dict, 0, 0, 0);
+
+    /* Entry-point parses the requests lazily */
+    exchange("GetParamNames, response delivered", MSGTYPE_GETPARAMNAMES, &client_dict, 0, -1, 0);
+    exchange("Lazy GetParamValue, no Id decoded", MSGTYPE_GETVALUE, &client_dict, 0, 0, 1);
+    exchange("Lazy SetParamValue, Id used", MSGTYPE_SETVALUE, &client_dict, 0, -1, 1);
+    exchange("Lazy GetParamValue, Id received and used", MSGTYPE_GETVALUE, &client_dict, 0, 1, 1);
+    mmx_path_dict_reset(&client_dict, 0);
+    exchange("Lazy GetParamValue of restarted client", MSGTYPE_GETVALUE, &client_dict, 0, 0, 1);
+    exchange("Lazy GetParamValue of restarted client again", MSGTYPE_GETVALUE, &client_dict, 0, 0, 1);
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
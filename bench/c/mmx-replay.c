@@ -0,0 +1,703 @@
+/* mmx-replay.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Replayer of the traffic captured by the front-end API
+ * (see mmx-frontapi-capture.h).
+ *
+ * Roles:
+ *   client - captured requests are sent to the Entry-Point, every captured
+ *            connection (stream) has its own socket. Requests are sent at
+ *            the captured times scaled by the speed (-s 1 - original speed,
+ *            -s 2 - twice faster) or, with -s 0, as fast as possible keeping
+ *            at most 'window' requests of all streams in flight. Throughput
+ *            and latency of the whole requests (till the last fragment)
+ *            are reported.
+ *   ep     - the replayer acts as the Entry-Point: a request is answered by
+ *            the captured response fragments of the same txaId (requests
+ *            with one txaId are answered in the captured order). The
+ *            responses are delayed as in the capture scaled by the speed,
+ *            or sent immediately with -s 0. Runs until SIGINT/SIGTERM.
+ *   dump   - records of the capture are printed.
+ *
+ * Replaying the capture against the replayer in the ep role is
+ * deterministic and measures the client side of the library only.
+ *
+ * Usage: mmx-replay [-r client|ep|dump] [-p port] [-s speed] [-w window]
+ *                   [-T timeout] [-j] capture_file
+ */
+
+#define _GNU_SOURCE     /* ppoll */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-capture.h"
+#include "mmx-bench.h"
+
+#define REPLAY_MAX_STREAMS   256
+#define REPLAY_MAX_PENDING   4096
+#define REPLAY_POLL_NS       10000000ULL   /* max wait, timeouts are checked after it */
+
+typedef enum replay_role_e {
+    REPLAY_ROLE_CLIENT = 0,
+    REPLAY_ROLE_EP,
+    REPLAY_ROLE_DUMP
+} replay_role_t;
+
+typedef struct replay_cfg_s {
+    replay_role_t role;
+    in_port_t port;
+    double speed;           /* 0 - as fast as possible */
+    unsigned window;        /* max requests in flight if speed is 0 */
+    unsigned timeout;
+    int json;
+} replay_cfg_t;
+
+/* Request of the client role waiting for its last response fragment */
+typedef struct replay_request_s {
+    int busy;
+    unsigned stream;
+    int32_t txaId;
+    uint64_t sent_ns;
+} replay_request_t;
+
+/* Record of the capture indexed by txaId (ep role) */
+typedef struct replay_entry_s {
+    int32_t txaId;
+    uint32_t seq;
+    int used;
+    const mmx_capture_rec_t *rec;
+} replay_entry_t;
+
+/* Response of the ep role waiting for its send time */
+typedef struct replay_reply_s {
+    int busy;
+    uint64_t due_ns;
+    struct sockaddr_in to;
+    const mmx_capture_rec_t *rec;
+} replay_reply_t;
+
+static replay_cfg_t cfg = {
+    .role = REPLAY_ROLE_CLIENT, .port = 10199, .speed = 1.0, .window = 1, .timeout = 2, .json = 0
+};
+
+static mmx_capture_t capture;
+static volatile sig_atomic_t stop;
+
+static void on_signal(int sig)
+{
+    stop = 1;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-r client|ep|dump] [-p port] [-s speed] [-w window]\n"
+                    "          [-T timeout] [-j] capture_file\n", prog);
+}
+
+/* Captured time 'ts' mapped to the replay clock */
+static uint64_t replay_due(uint64_t start_ns, uint64_t first_ts, uint64_t ts)
+{
+    return start_ns + (uint64_t)((ts - first_ts) / cfg.speed);
+}
+
+/* Parses header of the captured packet; requests start with the flags of ep_packet_t */
+static int rec_header(const mmx_capture_rec_t *rec, ep_msg_header_t *hdr)
+{
+    char buf[MMXFA_MAX_DATAGRAM_SIZE + 1];
+    size_t skip = rec->dir == MMX_CAPTURE_DIR_SENT ? sizeof(ep_packet_t) : 0;
+
+    memset(hdr, 0, sizeof(*hdr));
+    if (rec->len <= skip || rec->len > MMXFA_MAX_DATAGRAM_SIZE)
+        return FA_INVALID_FORMAT;
+
+    memcpy(buf, mmx_capture_data(rec), rec->len);
+    buf[rec->len] = '\0';
+    return mmx_frontapi_msg_header_parse(buf + skip, hdr);
+}
+
+static const mmx_capture_rec_t *next_sent(const mmx_capture_rec_t *rec)
+{
+    while ((rec = mmx_capture_next(&capture, rec)) != NULL)
+        if (rec->dir == MMX_CAPTURE_DIR_SENT)
+            return rec;
+    return NULL;
+}
+
+/*
+ * Dump role
+ */
+static int replay_dump(void)
+{
+    const mmx_capture_rec_t *rec = NULL;
+    ep_msg_header_t hdr;
+    uint64_t first = 0;
+    unsigned long count[2] = {0, 0};
+
+    while ((rec = mmx_capture_next(&capture, rec)) != NULL)
+    {
+        if (first == 0)
+            first = rec->ts_ns;
+
+        rec_header(rec, &hdr);
+
+        if (cfg.json)
+            printf("{\"t_us\": %.1f, \"dir\": \"%s\", \"stream\": %d, \"txaId\": %d, "
+                   "\"len\": %u, \"msgType\": \"%s\", \"moreFlag\": %d}\n",
+                   (rec->ts_ns - first) / 1e3, rec->dir == MMX_CAPTURE_DIR_SENT ? "sent" : "received",
+                   rec->stream, rec->txaId, rec->len, msgtype2str(hdr.msgType), hdr.moreFlag);
+        else
+            printf("%12.1f us  %-8s stream %-4d txaId %-10d %5u bytes  %s%s\n",
+                   (rec->ts_ns - first) / 1e3, rec->dir == MMX_CAPTURE_DIR_SENT ? "sent" : "received",
+                   rec->stream, rec->txaId, rec->len, msgtype2str(hdr.msgType),
+                   hdr.moreFlag ? " (more)" : "");
+        count[rec->dir == MMX_CAPTURE_DIR_SENT ? 0 : 1]++;
+    }
+
+    if (!cfg.json)
+        printf("sent %lu, received %lu, dropped by capture %llu\n", count[0], count[1],
+               (unsigned long long)capture.hdr->dropped);
+    return 0;
+}
+
+/*
+ * Client role
+ */
+
+/*
+ * Returns index of the socket of the stream of the request 'rec'; a new
+ * socket is bound to the response port of the request if possible
+ */
+static int stream_socket(int32_t *ids, int *socks, struct pollfd *fds, unsigned *count,
+                         const mmx_capture_rec_t *rec, unsigned *idx)
+{
+    ep_msg_header_t hdr;
+    struct sockaddr_in own;
+    int32_t id = rec->stream;
+    unsigned i;
+
+    for (i = 0; i < *count; i++)
+        if (ids[i] == id)
+        {
+            *idx = i;
+            return 0;
+        }
+
+    if (*count == REPLAY_MAX_STREAMS)
+        return -1;
+
+    if ((socks[i] = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+        return -1;
+
+    /* Entry-Point sends responses to the port given in the request */
+    if (rec_header(rec, &hdr) == FA_OK && hdr.respPort)
+    {
+        memset(&own, 0, sizeof(own));
+        own.sin_family = AF_INET;
+        own.sin_port = htons((in_port_t)hdr.respPort);
+        own.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (bind(socks[i], (struct sockaddr *)&own, sizeof(own)) != 0)
+            fprintf(stderr, "replay: could not bind port %d of stream %d, responses may be lost\n",
+                    hdr.respPort, id);
+    }
+    ids[i] = id;
+    fds[i].fd = socks[i];
+    fds[i].events = POLLIN;
+    (*count)++;
+    *idx = i;
+    return 0;
+}
+
+static int replay_client(void)
+{
+    static replay_request_t reqs[REPLAY_MAX_PENDING];
+    int32_t ids[REPLAY_MAX_STREAMS];
+    int socks[REPLAY_MAX_STREAMS];
+    struct pollfd fds[REPLAY_MAX_STREAMS];
+    unsigned nstreams = 0, stream, i;
+    struct sockaddr_in dest;
+    const mmx_capture_rec_t *rec, *last = NULL;
+    ep_msg_header_t hdr;
+    char buf[MMXFA_MAX_DATAGRAM_SIZE];
+    uint64_t start, now, wait_ns, first_ts, elapsed, *lat;
+    unsigned long total = 0, sent = 0, done = 0, timeouts = 0, unexpected = 0, errors = 0;
+    unsigned inflight = 0;
+    struct timespec ts;
+    ssize_t res;
+    double secs, captured;
+
+    for (rec = next_sent(NULL); rec; rec = next_sent(rec))
+    {
+        total++;
+        last = rec;
+    }
+    if (total == 0)
+    {
+        fprintf(stderr, "replay: no requests in the capture\n");
+        return 1;
+    }
+    if ((lat = malloc(total * sizeof(*lat))) == NULL)
+    {
+        fprintf(stderr, "replay: not enough memory\n");
+        return 1;
+    }
+
+    memset(&dest, 0, sizeof(dest));
+    dest.sin_family = AF_INET;
+    dest.sin_port = htons(cfg.port);
+    dest.sin_addr.s_addr = htonl(MMX_EP_ADDR);
+
+    rec = next_sent(NULL);
+    first_ts = rec->ts_ns;
+    captured = (last->ts_ns - first_ts) / 1e9;
+    start = mmx_bench_now_ns();
+
+    while ((rec || inflight) && !stop)
+    {
+        /* Send the requests that are due */
+        now = mmx_bench_now_ns();
+        while (rec && inflight < REPLAY_MAX_PENDING)
+        {
+            if (cfg.speed > 0 ? now < replay_due(start, first_ts, rec->ts_ns) : inflight >= cfg.window)
+                break;
+
+            if (stream_socket(ids, socks, fds, &nstreams, rec, &stream) != 0)
+            {
+                fprintf(stderr, "replay: too many streams\n");
+                stop = 1;
+                break;
+            }
+
+            if (sendto(socks[stream], mmx_capture_data(rec), rec->len, 0,
+                       (struct sockaddr *)&dest, sizeof(dest)) < 0)
+                errors++;
+            else
+            {
+                for (i = 0; reqs[i].busy; i++)
+                    ;  /* there is a free slot: inflight < REPLAY_MAX_PENDING */
+                reqs[i].busy = 1;
+                reqs[i].stream = stream;
+                reqs[i].txaId = rec->txaId;
+                reqs[i].sent_ns = mmx_bench_now_ns();
+                inflight++;
+                sent++;
+            }
+            rec = next_sent(rec);
+        }
+
+        /* Wait for responses till the next request is due */
+        wait_ns = REPLAY_POLL_NS;
+        if (rec && cfg.speed > 0)
+        {
+            now = mmx_bench_now_ns();
+            if (replay_due(start, first_ts, rec->ts_ns) <= now)
+                wait_ns = 0;
+            else if (replay_due(start, first_ts, rec->ts_ns) - now < wait_ns)
+                wait_ns = replay_due(start, first_ts, rec->ts_ns) - now;
+        }
+        else if (rec && inflight < cfg.window)
+            wait_ns = 0;
+
+        ts.tv_sec = 0;
+        ts.tv_nsec = (long)wait_ns;
+        if (ppoll(fds, nstreams, &ts, NULL) < 0 && errno != EINTR)
+        {
+            perror("replay: poll");
+            break;
+        }
+
+        for (stream = 0; stream < nstreams; stream++)
+        {
+            if (!(fds[stream].revents & POLLIN))
+                continue;
+
+            while ((res = recv(socks[stream], buf, sizeof(buf) - 1, MSG_DONTWAIT)) > 0)
+            {
+                buf[res] = '\0';
+                memset(&hdr, 0, sizeof(hdr));
+                if (mmx_frontapi_msg_header_parse(buf, &hdr) != FA_OK)
+                {
+                    unexpected++;
+                    continue;
+                }
+
+                for (i = 0; i < REPLAY_MAX_PENDING; i++)
+                    if (reqs[i].busy && reqs[i].stream == stream && reqs[i].txaId == hdr.txaId)
+                        break;
+                if (i == REPLAY_MAX_PENDING)
+                {
+                    unexpected++;
+                    continue;
+                }
+
+                if (!hdr.moreFlag)
+                {
+                    lat[done++] = mmx_bench_now_ns() - reqs[i].sent_ns;
+                    reqs[i].busy = 0;
+                    inflight--;
+                }
+            }
+        }
+
+        /* Give up requests whose response was not received in time */
+        now = mmx_bench_now_ns();
+        for (i = 0; i < REPLAY_MAX_PENDING && inflight; i++)
+        {
+            if (reqs[i].busy && now - reqs[i].sent_ns >= cfg.timeout * 1000000000ULL)
+            {
+                reqs[i].busy = 0;
+                inflight--;
+                timeouts++;
+            }
+        }
+    }
+    elapsed = mmx_bench_now_ns() - start;
+
+    for (i = 0; i < nstreams; i++)
+        close(socks[i]);
+
+    qsort(lat, done, sizeof(*lat), mmx_bench_cmp_u64);
+    secs = elapsed / 1e9;
+
+    if (cfg.json)
+    {
+        printf("{\"role\": \"client\", \"speed\": %.2f, \"streams\": %u, \"requests\": %lu, "
+               "\"sent\": %lu, \"completed\": %lu, \"timeouts\": %lu, \"unexpected\": %lu, "
+               "\"send_errors\": %lu, \"captured_s\": %.3f, \"elapsed_s\": %.3f, "
+               "\"throughput_rps\": %.1f, \"p50_us\": %.1f, \"p99_us\": %.1f, "
+               "\"p999_us\": %.1f, \"max_us\": %.1f}\n",
+               cfg.speed, nstreams, total, sent, done, timeouts, unexpected, errors,
+               captured, secs, secs > 0 ? done / secs : 0,
+               mmx_bench_percentile(lat, done, 0.50) / 1e3,
+               mmx_bench_percentile(lat, done, 0.99) / 1e3,
+               mmx_bench_percentile(lat, done, 0.999) / 1e3,
+               mmx_bench_percentile(lat, done, 1.0) / 1e3);
+    }
+    else
+    {
+        printf("replay: %lu requests of %u streams, captured in %.3f s, replayed in %.3f s "
+               "(speed %.2f)\n", total, nstreams, captured, secs, cfg.speed);
+        printf("sent %lu, completed %lu, timeouts %lu, unexpected %lu, send errors %lu, "
+               "%.1f req/s\n", sent, done, timeouts, unexpected, errors,
+               secs > 0 ? done / secs : 0);
+        printf("latency us: p50 %.1f, p99 %.1f, p999 %.1f, max %.1f\n",
+               mmx_bench_percentile(lat, done, 0.50) / 1e3,
+               mmx_bench_percentile(lat, done, 0.99) / 1e3,
+               mmx_bench_percentile(lat, done, 0.999) / 1e3,
+               mmx_bench_percentile(lat, done, 1.0) / 1e3);
+    }
+
+    free(lat);
+    return (timeouts || errors) ? 2 : 0;
+}
+
+/*
+ * Entry-point role
+ */
+static int cmp_entry(const void *a, const void *b)
+{
+    const replay_entry_t *x = a, *y = b;
+
+    if (x->txaId != y->txaId)
+        return x->txaId < y->txaId ? -1 : 1;
+    return (x->seq > y->seq) - (x->seq < y->seq);
+}
+
+/* Returns the first entry of the txaId or NULL */
+static replay_entry_t *find_txa(replay_entry_t *entries, size_t count, int32_t txaId)
+{
+    size_t lo = 0, hi = count, mid;
+
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (entries[mid].txaId < txaId)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return (lo < count && entries[lo].txaId == txaId) ? &entries[lo] : NULL;
+}
+
+static int replay_ep(void)
+{
+    static replay_reply_t replies[REPLAY_MAX_PENDING];
+    replay_entry_t *entries, *e, *end, *req;
+    const mmx_capture_rec_t *rec = NULL;
+    char buf[MMXFA_MAX_DATAGRAM_SIZE];
+    ep_packet_t *packet = (ep_packet_t *)buf;
+    ep_msg_header_t hdr;
+    struct sockaddr_in from;
+    socklen_t from_len;
+    struct pollfd pfd;
+    struct timespec ts;
+    size_t count = 0;
+    uint64_t now, wait_ns;
+    unsigned long requests = 0, responses = 0, unknown = 0, wrapped = 0, overflow = 0;
+    ssize_t res;
+    unsigned i;
+    int sock = -1;
+
+    while ((rec = mmx_capture_next(&capture, rec)) != NULL)
+        count++;
+    if ((entries = calloc(count ? count : 1, sizeof(*entries))) == NULL)
+    {
+        fprintf(stderr, "replay: not enough memory\n");
+        return 1;
+    }
+    count = 0;
+    while ((rec = mmx_capture_next(&capture, rec)) != NULL)
+    {
+        entries[count].txaId = rec->txaId;
+        entries[count].seq = (uint32_t)count;
+        entries[count].rec = rec;
+        count++;
+    }
+    qsort(entries, count, sizeof(*entries), cmp_entry);
+
+    if (udp_socket_init(&sock, MMX_EP_ADDR, cfg.port))
+    {
+        perror("replay: could not initialize socket");
+        free(entries);
+        return 1;
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    printf("replay: Entry-Point on port %u, %zu records, speed %.2f\n", cfg.port, count, cfg.speed);
+    fflush(stdout);
+
+    pfd.fd = sock;
+    pfd.events = POLLIN;
+
+    while (!stop)
+    {
+        /* Send the due responses */
+        now = mmx_bench_now_ns();
+        wait_ns = REPLAY_POLL_NS * 100;
+        for (i = 0; i < REPLAY_MAX_PENDING; i++)
+        {
+            if (!replies[i].busy)
+                continue;
+            if (replies[i].due_ns <= now)
+            {
+                if (sendto(sock, mmx_capture_data(replies[i].rec), replies[i].rec->len, 0,
+                           (struct sockaddr *)&replies[i].to, sizeof(replies[i].to)) >= 0)
+                    responses++;
+                replies[i].busy = 0;
+            }
+            else if (replies[i].due_ns - now < wait_ns)
+                wait_ns = replies[i].due_ns - now;
+        }
+
+        ts.tv_sec = (time_t)(wait_ns / 1000000000ULL);
+        ts.tv_nsec = (long)(wait_ns % 1000000000ULL);
+        res = ppoll(&pfd, 1, &ts, NULL);
+        if (res < 0 && errno != EINTR)
+        {
+            perror("replay: poll");
+            break;
+        }
+        if (res <= 0)
+            continue;
+
+        from_len = sizeof(from);
+        res = recvfrom(sock, buf, sizeof(buf) - 1, 0, (struct sockaddr *)&from, &from_len);
+        if (res <= (ssize_t)sizeof(ep_packet_t))
+            continue;
+        buf[res] = '\0';
+        requests++;
+
+        memset(&hdr, 0, sizeof(hdr));
+        if (mmx_frontapi_msg_header_parse(packet->msg, &hdr) != FA_OK ||
+            (e = find_txa(entries, count, hdr.txaId)) == NULL)
+        {
+            unknown++;
+            continue;
+        }
+        for (end = e; end < entries + count && end->txaId == hdr.txaId; end++)
+            ;
+
+        /* The first request of the txaId not replayed yet (start over if all were) */
+        for (req = e; req < end; req++)
+            if (!req->used && req->rec->dir == MMX_CAPTURE_DIR_SENT)
+                break;
+        if (req == end)
+        {
+            for (req = e; req < end; req++)
+                req->used = 0;
+            for (req = e; req < end && req->rec->dir != MMX_CAPTURE_DIR_SENT; req++)
+                ;
+            wrapped++;
+        }
+        if (req == end)
+        {
+            unknown++;
+            continue;
+        }
+        req->used = 1;
+
+        /* Its responses are the received packets till the next request */
+        now = mmx_bench_now_ns();
+        for (e = req + 1; e < end && e->rec->dir == MMX_CAPTURE_DIR_RECEIVED; e++)
+        {
+            e->used = 1;
+            if (cfg.speed == 0)
+            {
+                if (sendto(sock, mmx_capture_data(e->rec), e->rec->len, 0,
+                           (struct sockaddr *)&from, from_len) >= 0)
+                    responses++;
+                continue;
+            }
+
+            for (i = 0; i < REPLAY_MAX_PENDING && replies[i].busy; i++)
+                ;
+            if (i == REPLAY_MAX_PENDING)
+            {
+                overflow++;
+                continue;
+            }
+            replies[i].busy = 1;
+            replies[i].due_ns = replay_due(now, req->rec->ts_ns, e->rec->ts_ns);
+            replies[i].to = from;
+            replies[i].rec = e->rec;
+        }
+    }
+
+    printf("replay: requests %lu, responses %lu, unknown %lu, replayed again %lu, overflow %lu\n",
+           requests, responses, unknown, wrapped, overflow);
+    close(sock);
+    free(entries);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int opt, res;
+
+    while ((opt = getopt(argc, argv, "r:p:s:w:T:jh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'r':
+            if (!strcmp(optarg, "client"))
+                cfg.role = REPLAY_ROLE_CLIENT;
+            else if (!strcmp(optarg, "ep"))
+                cfg.role = REPLAY_ROLE_EP;
+            else if (!strcmp(optarg, "dump"))
+                cfg.role = REPLAY_ROLE_DUMP;
+            else
+            {
+                usage(argv[0]);
+                return 1;
+            }
+            break;
+        case 'p': cfg.port = (in_port_t)atoi(optarg); break;
+        case 's': cfg.speed = atof(optarg); break;
+        case 'w': cfg.window = (unsigned)atoi(optarg); break;
+        case 'T': cfg.timeout = (unsigned)atoi(optarg); break;
+        case 'j': cfg.json = 1; break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (optind != argc - 1 || cfg.speed < 0)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    if (cfg.window == 0 || cfg.window > REPLAY_MAX_PENDING)
+        cfg.window = REPLAY_MAX_PENDING;
+
+    if (mmx_capture_load(&capture, argv[optind]) != FA_OK)
+    {
+        fprintf(stderr, "replay: could not load capture %s\n", argv[optind]);
+        return 1;
+    }
+
+    switch (cfg.role)
+    {
+    case REPLAY_ROLE_CLIENT: res = replay_client(); break;
+    case REPLAY_ROLE_EP: res = replay_ep(); break;
+    default: res = replay_dump(); break;
+    }
+
+    mmx_capture_close(&capture);
+    return res;
+}
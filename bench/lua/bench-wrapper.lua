@@ -0,0 +1,292 @@
+--[[
+#
+# bench-wrapper.lua
+#
+# Copyright (c) 2013-2021 Inango Systems LTD.
+#
+# Author: Inango Systems LTD. <support@inango-systems.com>
+# Creation Date: Oct 2026
+#
+# The author may be reached at support@inango-systems.com
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+# this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# Subject to the terms and conditions of this license, each copyright holder
+# and contributor hereby grants to those receiving rights under this license
+# a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+# (except for failure to satisfy the conditions of this license) patent license
+# to make, have made, use, offer to sell, sell, import, and otherwise transfer
+# this software, where such license applies only to those patent claims, already
+# acquired or hereafter acquired, licensable by such copyright holder or contributor
+# that are necessarily infringed by:
+#
+# (a) their Contribution(s) (the licensed copyrights of copyright holders and
+# non-copyrightable additions of contributors, in source or binary form) alone;
+# or
+#
+# (b) combination of their Contribution(s) with the work of authorship to which
+# such Contribution(s) was added by such copyright holder or contributor, if,
+# at the time the Contribution is added, such addition causes such combination
+# to be necessarily infringed. The patent license shall not apply to any other
+# combinations which include the Contribution.
+#
+# Except as expressly stated above, no rights or licenses from any copyright
+# holder or contributor is granted under this license, whether expressly, by
+# implication, estoppel or otherwise.
+#
+# DISCLAIMER
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+# USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# NOTE
+#
+# This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+#
+# This version of MMX provides web and command-line management interfaces.
+#
+# Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+# - other management packages, such as SNMP, TR-069 or Netconf
+# - how we can extend the data model to support all parts of your system
+# - professional sub-contract and customization services
+#
+--]]
+
+--[[ Description:
+       Benchmark of MMXAPIWrapper methods against the mock Entry-Point
+       (mock-ep.lua). For every data size and fragment count each method
+       is called the given number of times; latency percentiles, memory
+       allocated per call and time of garbage collection of that memory
+       are reported.
+
+       The front-end sends requests to MMX_FRONTAPI_EP_PORT, the mock EP
+       is started on the same port (unless --no-mock is given).
+
+       Usage: MMX_FRONTAPI_EP_PORT=10199 lua bench-wrapper.lua
+                  [--sizes 10,100,500] [--fragments 1,4] [--iterations 100]
+                  [--methods getMultipleInstances,countRow,...] [--delay <ms>]
+                  [--lua <interpreter>] [--csv] [--no-mock]
+--]]
+
+local benchDir = string.match(arg[0], "^(.*)/[^/]*$") or "."
+local srcDir = benchDir .. "/../../src/lua/"
+
+-- Modules "mmx.<name>" are taken from the source tree when they are there
+table.insert(package.loaders, 2, function(modName)
+    local file = string.match(modName, "^mmx%.(.+)$")
+    if file then
+        local path = srcDir .. file .. ".lua"
+        local f = io.open(path)
+        if f then
+            f:close()
+            return assert(loadfile(path))
+        end
+    end
+end)
+
+local socket = require "socket"
+require "mmx.mmx_api_wrapper"
+
+local STATIONS = "Device.WiFi.AccessPoint.1.AssociatedDevice."
+local ROUTERS  = "Device.Routers."
+
+local opts = {
+    sizes      = "10,100,500",
+    fragments  = "1,4",
+    iterations = 100,
+    methods    = "",
+    delay      = 0,
+    lua        = "lua",
+}
+local flags = {csv = false, ["no-mock"] = false}
+
+local i = 1
+while arg[i] do
+    local key = string.match(arg[i], "^%-%-(.+)$")
+    if key and flags[key] ~= nil then
+        flags[key] = true
+        i = i + 1
+    elseif key and opts[key] ~= nil and arg[i + 1] then
+        opts[key] = tonumber(arg[i + 1]) or arg[i + 1]
+        i = i + 2
+    else
+        io.stderr:write("bench-wrapper: bad argument ", arg[i], "\n")
+        os.exit(1)
+    end
+end
+
+local function numberList(str)
+    local list = {}
+    for num in string.gmatch(tostring(str), "%d+") do
+        list[#list + 1] = tonumber(num)
+    end
+    return list
+end
+
+local epPort = tonumber(os.getenv("MMX_FRONTAPI_EP_PORT") or "") or 10100
+
+-- Sends control command to the mock EP and waits for its reply
+local ctrlSock = socket.udp()
+ctrlSock:settimeout(0.2)
+
+local function mockCommand(cmd, tries)
+    for _ = 1, tries or 1 do
+        ctrlSock:sendto("MOCKEP " .. cmd, "127.0.0.1", epPort)
+        if ctrlSock:receivefrom() == "OK" then
+            return true
+        end
+    end
+    return false
+end
+
+-- Methods under test; 'size' is the number of instances of the scaled tables
+local methods = {
+    {
+        name = "getMultipleInstances(*)",
+        run  = function(wrapper, size)
+            return wrapper:getMultipleInstances({
+                [STATIONS .. "*."] = {"MACAddress", "HostName", "SignalStrength", "Active"}})
+        end,
+    },
+    {
+        name = "getMultipleInstances(list)",
+        run  = function(wrapper, size)
+            local paths = {}
+            for inst = 1, math.min(size, 64) do
+                paths[STATIONS .. inst .. "."] = {"MACAddress", "SignalStrength"}
+            end
+            return wrapper:getMultipleInstances(paths)
+        end,
+    },
+    {
+        name = "countRow",
+        run  = function(wrapper, size)
+            return wrapper:countRow(STATIONS .. "{i}.")
+        end,
+    },
+    {
+        name = "setParamValue",
+        run  = function(wrapper, size)
+            return wrapper:setParamValue(STATIONS .. "1.", 0, {HostName = "bench & <test>", Active = "false"})
+        end,
+    },
+    {
+        name = "addInstance",
+        run  = function(wrapper, size)
+            return wrapper:addInstance(ROUTERS, {Name = "bench", Enable = "false"})
+        end,
+    },
+}
+
+local function selected(method)
+    if opts.methods == "" then
+        return true
+    end
+    for name in string.gmatch(opts.methods, "[^,]+") do
+        if string.sub(method.name, 1, #name) == name then
+            return true
+        end
+    end
+    return false
+end
+
+local function percentile(sorted, q)
+    return sorted[math.max(1, math.ceil(q * #sorted))] or 0
+end
+
+-- Calls method 'iterations' times; returns statistics of the calls
+local function measure(wrapper, method, size)
+    local latencies, allocKb, gcTime, errors = {}, 0, 0, 0
+
+    for _ = 1, 3 do
+        method.run(wrapper, size)
+    end
+
+    for n = 1, opts.iterations do
+        collectgarbage("collect")
+        collectgarbage("stop")
+        local kb0 = collectgarbage("count")
+        local t0 = socket.gettime()
+        local errcode = method.run(wrapper, size)
+        local t1 = socket.gettime()
+        local kb1 = collectgarbage("count")
+        collectgarbage("collect")
+        local t2 = socket.gettime()
+        collectgarbage("restart")
+
+        latencies[n] = (t1 - t0) * 1000
+        allocKb = allocKb + (kb1 - kb0)
+        gcTime = gcTime + (t2 - t1) * 1000
+        if errcode ~= 0 then
+            errors = errors + 1
+        end
+    end
+
+    table.sort(latencies)
+    return {
+        calls  = opts.iterations,
+        p50    = percentile(latencies, 0.50),
+        p90    = percentile(latencies, 0.90),
+        p99    = percentile(latencies, 0.99),
+        max    = latencies[#latencies] or 0,
+        kb     = allocKb / opts.iterations,
+        gc     = gcTime / opts.iterations,
+        errors = errors,
+    }
+end
+
+if not flags["no-mock"] then
+    os.execute(string.format("%s %s/mock-ep.lua --port %d &", opts.lua, benchDir, epPort))
+end
+if not mockCommand("ping", 25) then
+    io.stderr:write("bench-wrapper: mock EP does not answer on port ", epPort, "\n")
+    os.exit(1)
+end
+
+if flags.csv then
+    print("method,size,fragments,calls,p50_ms,p90_ms,p99_ms,max_ms,alloc_kb_per_call,gc_ms_per_call,errors")
+else
+    print(string.format("%-28s %6s %5s %6s %9s %9s %9s %9s %10s %10s %6s",
+                        "method", "size", "frag", "calls", "p50 ms", "p90 ms", "p99 ms",
+                        "max ms", "KB/call", "gc ms/call", "errors"))
+end
+
+local wrapper = MMXAPIWrapper.create(1)
+
+for _, size in ipairs(numberList(opts.sizes)) do
+    for _, fragments in ipairs(numberList(opts.fragments)) do
+        for _, method in ipairs(methods) do
+            if selected(method) then
+                -- every method starts with fresh data model of given size
+                mockCommand(string.format("reset size=%d fragments=%d delay=%d",
+                                          size, fragments, opts.delay), 5)
+                local st = measure(wrapper, method, size)
+                local fmt = flags.csv and "%s,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.1f,%.3f,%d" or
+                            "%-28s %6d %5d %6d %9.3f %9.3f %9.3f %9.3f %10.1f %10.3f %6d"
+                print(string.format(fmt, method.name, size, fragments, st.calls, st.p50, st.p90,
+                                    st.p99, st.max, st.kb, st.gc, st.errors))
+            end
+        end
+    end
+end
+
+mmx_frontapi_log_flush()
+if not flags["no-mock"] then
+    mockCommand("quit", 5)
+end
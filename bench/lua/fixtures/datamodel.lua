@@ -0,0 +1,134 @@
+--[[
+#
+# datamodel.lua
+#
+# Copyright (c) 2013-2021 Inango Systems LTD.
+#
+# Author: Inango Systems LTD. <support@inango-systems.com>
+# Creation Date: Oct 2026
+#
+# The author may be reached at support@inango-systems.com
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+# this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# Subject to the terms and conditions of this license, each copyright holder
+# and contributor hereby grants to those receiving rights under this license
+# a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+# (except for failure to satisfy the conditions of this license) patent license
+# to make, have made, use, offer to sell, sell, import, and otherwise transfer
+# this software, where such license applies only to those patent claims, already
+# acquired or hereafter acquired, licensable by such copyright holder or contributor
+# that are necessarily infringed by:
+#
+# (a) their Contribution(s) (the licensed copyrights of copyright holders and
+# non-copyrightable additions of contributors, in source or binary form) alone;
+# or
+#
+# (b) combination of their Contribution(s) with the work of authorship to which
+# such Contribution(s) was added by such copyright holder or contributor, if,
+# at the time the Contribution is added, such addition causes such combination
+# to be necessarily infringed. The patent license shall not apply to any other
+# combinations which include the Contribution.
+#
+# Except as expressly stated above, no rights or licenses from any copyright
+# holder or contributor is granted under this license, whether expressly, by
+# implication, estoppel or otherwise.
+#
+# DISCLAIMER
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+# USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# NOTE
+#
+# This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+#
+# This version of MMX provides web and command-line management interfaces.
+#
+# Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+# - other management packages, such as SNMP, TR-069 or Netconf
+# - how we can extend the data model to support all parts of your system
+# - professional sub-contract and customization services
+#
+--]]
+
+--[[ Description:
+       Data model served by the mock Entry-Point (mock-ep.lua).
+       Parameter values were recorded from a home gateway; "{i}" in names
+       and values is replaced by the instance number. Tables marked as
+       "scaled" get the number of instances given by the benchmark size,
+       the others have "count" instances.
+--]]
+
+return {
+    {
+        path   = "Device.DeviceInfo.",
+        params = {
+            Manufacturer    = "Inango",
+            ModelName       = "HGW-2000",
+            SoftwareVersion = "5.4.1-r12",
+            SerialNumber    = "IN00A1B2C3D4",
+            UpTime          = "86400",
+        },
+    },
+    {
+        path   = "Device.IP.Interface.",
+        count  = 4,
+        params = {
+            InterfaceIndex = "{i}",
+            Enable         = "true",
+            Status         = "Up",
+            Name           = "br-lan{i}",
+            Alias          = "cpe-ip-{i}",
+            LowerLayers    = "Device.Bridging.Bridge.{i}.Port.1.",
+            MaxMTUSize     = "1500",
+        },
+    },
+    {
+        path   = "Device.WiFi.AccessPoint.1.AssociatedDevice.",
+        scaled = true,
+        params = {
+            AssociatedDeviceIndex = "{i}",
+            MACAddress            = "a4:5e:60:c1:{i}:1f",
+            HostName              = "Station {i} <guest & co>",
+            AuthenticationState   = "true",
+            LastDataDownlinkRate  = "866700",
+            LastDataUplinkRate    = "585000",
+            SignalStrength        = "-5{i}",
+            Retransmissions       = "12",
+            Active                = "true",
+            OperatingStandard     = "ac",
+            ["Stats.BytesSent"]       = "{i}48211302",
+            ["Stats.BytesReceived"]   = "{i}1930488",
+            ["Stats.PacketsSent"]     = "{i}40871",
+            ["Stats.PacketsReceived"] = "{i}12288",
+            ["Stats.ErrorsSent"]      = "0",
+        },
+    },
+    {
+        path   = "Device.Routers.",
+        scaled = true,
+        params = {
+            RoutersIndex = "{i}",
+            Device       = "a323b336-9177-4b32-a93f-{i}",
+            Enable       = "true",
+            Name         = "router-{i}",
+        },
+    },
+}
@@ -0,0 +1,367 @@
+--[[
+#
+# mock-ep.lua
+#
+# Copyright (c) 2013-2021 Inango Systems LTD.
+#
+# Author: Inango Systems LTD. <support@inango-systems.com>
+# Creation Date: Oct 2026
+#
+# The author may be reached at support@inango-systems.com
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+# this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# Subject to the terms and conditions of this license, each copyright holder
+# and contributor hereby grants to those receiving rights under this license
+# a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+# (except for failure to satisfy the conditions of this license) patent license
+# to make, have made, use, offer to sell, sell, import, and otherwise transfer
+# this software, where such license applies only to those patent claims, already
+# acquired or hereafter acquired, licensable by such copyright holder or contributor
+# that are necessarily infringed by:
+#
+# (a) their Contribution(s) (the licensed copyrights of copyright holders and
+# non-copyrightable additions of contributors, in source or binary form) alone;
+# or
+#
+# (b) combination of their Contribution(s) with the work of authorship to which
+# such Contribution(s) was added by such copyright holder or contributor, if,
+# at the time the Contribution is added, such addition causes such combination
+# to be necessarily infringed. The patent license shall not apply to any other
+# combinations which include the Contribution.
+#
+# Except as expressly stated above, no rights or licenses from any copyright
+# holder or contributor is granted under this license, whether expressly, by
+# implication, estoppel or otherwise.
+#
+# DISCLAIMER
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+# USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# NOTE
+#
+# This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+#
+# This version of MMX provides web and command-line management interfaces.
+#
+# Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+# - other management packages, such as SNMP, TR-069 or Netconf
+# - how we can extend the data model to support all parts of your system
+# - professional sub-contract and customization services
+#
+--]]
+
+--[[ Description:
+       Scripted stand-in for the MMX Entry-Point used by the benchmarks.
+       It listens for front-end requests on UDP port (--port) and answers
+       GetParamValue, GetParamNames, SetParamValue, AddObject and DelObject
+       from the data model of the fixture file (--fixture), splitting
+       GetParamValue responses into the configured number of fragments.
+
+       Control datagrams (replied with "OK" to the sender):
+         MOCKEP ping
+         MOCKEP reset size=<instances> fragments=<n> delay=<ms> loss=<percent>
+         MOCKEP quit
+
+       Usage: lua mock-ep.lua [--port 10199] [--fixture fixtures/datamodel.lua]
+                              [--size 100] [--fragments 1] [--delay 0] [--loss 0]
+--]]
+
+local socket = require "socket"
+
+local benchDir = string.match(arg[0], "^(.*)/[^/]*$") or "."
+
+-- Response fragments are kept below the front-end datagram limit
+local MAX_FRAGMENT_BYTES = 30000
+
+local MMX_ERROR_INVALID_PARAM_NAME = 9005
+
+local opts = {
+    port      = 10199,
+    fixture   = benchDir .. "/fixtures/datamodel.lua",
+    size      = 100,
+    fragments = 1,
+    delay     = 0,
+    loss      = 0,
+}
+
+local i = 1
+while arg[i] do
+    local key = string.match(arg[i], "^%-%-(.+)$")
+    if key == nil or opts[key] == nil or arg[i + 1] == nil then
+        io.stderr:write("mock-ep: bad argument ", arg[i], "\n")
+        os.exit(1)
+    end
+    opts[key] = tonumber(arg[i + 1]) or arg[i + 1]
+    i = i + 2
+end
+
+local fixture = dofile(opts.fixture)
+
+-- Data model: sorted parameter names, their values and next instance
+-- number of every table
+local model = {}
+
+local function model_add_instance(tbl, inst, override)
+    for name, value in pairs(tbl.params) do
+        local fullName = tbl.path .. inst .. "." .. name
+        if model.values[fullName] == nil then
+            model.names[#model.names + 1] = fullName
+        end
+        model.values[fullName] = string.gsub((override and override[name]) or value, "{i}", inst)
+    end
+    model.sorted = false
+end
+
+local function model_reset(size)
+    model = {names = {}, values = {}, nextInst = {}, tables = {}, sorted = false}
+    for _, tbl in ipairs(fixture) do
+        model.tables[tbl.path] = tbl
+        if tbl.scaled or tbl.count then
+            local count = tbl.scaled and size or tbl.count
+            for inst = 1, count do
+                model_add_instance(tbl, inst)
+            end
+            model.nextInst[tbl.path] = count + 1
+        else
+            for name, value in pairs(tbl.params) do
+                model.names[#model.names + 1] = tbl.path .. name
+                model.values[tbl.path .. name] = value
+            end
+        end
+    end
+end
+
+local function model_names()
+    if not model.sorted then
+        local names = {}
+        for _, name in ipairs(model.names) do
+            if model.values[name] ~= nil then
+                names[#names + 1] = name
+            end
+        end
+        table.sort(names)
+        model.names, model.sorted = names, true
+    end
+    return model.names
+end
+
+-- Returns names of the model matching requested name (with "*" placeholders)
+local function model_select(reqName, nextLevel)
+    local pat = string.gsub(reqName, "[%^%$%(%)%%%.%[%]%+%-%?]", "%%%0")
+    pat = "^" .. string.gsub(pat, "%*", "%%d+")
+    if string.sub(reqName, -1) == "." then
+        pat = pat .. (nextLevel and "[^%.]+$" or "")
+    else
+        pat = pat .. "$"
+    end
+
+    local selected = {}
+    for _, name in ipairs(model_names()) do
+        if string.find(name, pat) then
+            selected[#selected + 1] = name
+        end
+    end
+    return selected
+end
+
+local xmlEscapes = {["&"] = "&amp;", ["<"] = "&lt;", [">"] = "&gt;", ['"'] = "&quot;", ["'"] = "&apos;"}
+local xmlEntities = {amp = "&", lt = "<", gt = ">", quot = '"', apos = "'"}
+
+local function escape(str)
+    return (string.gsub(str, "[&<>\"']", xmlEscapes))
+end
+
+local function unescape(str)
+    return (string.gsub(str, "&(%a+);", xmlEntities))
+end
+
+local function response(hdr, msgType, resCode, body, more)
+    return table.concat({
+        "<EP_ApiMsg><hdr><callerId>", hdr.callerId, "</callerId><txaId>", hdr.txaId,
+        "</txaId><resCode>", resCode, "</resCode><moreFlag>", more or 0,
+        "</moreFlag><msgType>", msgType, "</msgType></hdr><body><", msgType, ">",
+        body, "</", msgType, "></body></EP_ApiMsg>"})
+end
+
+-- Handlers of requests; return list of response datagrams
+local handlers = {}
+
+handlers.GetParamValue = function(hdr, req)
+    local nextLevel = string.match(req, "<nextLevel>(%a+)</nextLevel>") == "true"
+    local pairsXml = {}
+    for reqName in string.gmatch(req, "<name>(.-)</name>") do
+        reqName = unescape(reqName)
+        local selected = model_select(reqName, nextLevel)
+        if #selected == 0 and string.sub(reqName, -1) ~= "." and
+           not string.find(reqName, "*", 1, true) then
+            return {response(hdr, "GetParamValueResponse", MMX_ERROR_INVALID_PARAM_NAME, "")}
+        end
+        for _, name in ipairs(selected) do
+            pairsXml[#pairsXml + 1] = "<nameValuePair><name>" .. escape(name) ..
+                                      "</name><value>" .. escape(model.values[name]) ..
+                                      "</value></nameValuePair>"
+        end
+    end
+
+    -- split the pairs into the configured number of fragments
+    local perFragment = math.max(1, math.ceil(#pairsXml / opts.fragments))
+    local chunks, chunk, chunkBytes = {}, {}, 0
+    for _, pairXml in ipairs(pairsXml) do
+        if #chunk == perFragment or chunkBytes + #pairXml > MAX_FRAGMENT_BYTES then
+            chunks[#chunks + 1] = chunk
+            chunk, chunkBytes = {}, 0
+        end
+        chunk[#chunk + 1] = pairXml
+        chunkBytes = chunkBytes + #pairXml
+    end
+    chunks[#chunks + 1] = chunk
+
+    local datagrams = {}
+    for n, c in ipairs(chunks) do
+        datagrams[n] = response(hdr, "GetParamValueResponse", 0,
+                                '<paramValues arraySize="' .. #c .. '">' ..
+                                table.concat(c) .. "</paramValues>",
+                                n < #chunks and 1 or 0)
+    end
+    return datagrams
+end
+
+handlers.GetParamNextValue = handlers.GetParamValue
+
+handlers.GetParamNames = function(hdr, req)
+    local pathName = unescape(string.match(req, "<pathName>(.-)</pathName>") or "")
+    local nextLevel = string.match(req, "<nextLevel>(%a+)</nextLevel>") == "true"
+    local infos = {}
+    for _, name in ipairs(model_select(pathName, nextLevel)) do
+        infos[#infos + 1] = "<paramInfo><name>" .. escape(name) .. "</name><writable>1</writable></paramInfo>"
+    end
+    return {response(hdr, "GetParamNamesResponse", 0,
+                     '<paramList arraySize="' .. #infos .. '">' .. table.concat(infos) .. "</paramList>")}
+end
+
+handlers.SetParamValue = function(hdr, req)
+    local faults = {}
+    local values = {}
+    for pairXml in string.gmatch(req, "<nameValuePair>(.-)</nameValuePair>") do
+        local name = unescape(string.match(pairXml, "<name>(.-)</name>") or "")
+        local value = unescape(string.match(pairXml, "<value>(.-)</value>") or "")
+        if model.values[name] == nil then
+            faults[#faults + 1] = "<paramFault><name>" .. escape(name) ..
+                                  "</name><faultcode>" .. MMX_ERROR_INVALID_PARAM_NAME ..
+                                  "</faultcode></paramFault>"
+        end
+        values[name] = value
+    end
+    if #faults > 0 then
+        return {response(hdr, "SetParamValueResponse", MMX_ERROR_INVALID_PARAM_NAME,
+                         '<paramFaults arraySize="' .. #faults .. '">' .. table.concat(faults) .. "</paramFaults>")}
+    end
+    for name, value in pairs(values) do
+        model.values[name] = value
+    end
+    return {response(hdr, "SetParamValueResponse", 0, "<status>0</status>")}
+end
+
+handlers.AddObject = function(hdr, req)
+    local objName = unescape(string.match(req, "<objName>(.-)</objName>") or "")
+    local tbl = model.tables[objName]
+    if tbl == nil or model.nextInst[objName] == nil then
+        return {response(hdr, "AddObjectResponse", MMX_ERROR_INVALID_PARAM_NAME, "")}
+    end
+    local override = {}
+    for pairXml in string.gmatch(req, "<nameValuePair>(.-)</nameValuePair>") do
+        local name = unescape(string.match(pairXml, "<name>(.-)</name>") or "")
+        override[name] = unescape(string.match(pairXml, "<value>(.-)</value>") or "")
+    end
+    local inst = model.nextInst[objName]
+    model.nextInst[objName] = inst + 1
+    model_add_instance(tbl, inst, override)
+    return {response(hdr, "AddObjectResponse", 0,
+                     "<objInstanceNumber>" .. inst .. "</objInstanceNumber><status>0</status>")}
+end
+
+handlers.DelObject = function(hdr, req)
+    for objName in string.gmatch(req, "<objName>(.-)</objName>") do
+        objName = unescape(objName)
+        for _, name in ipairs(model_names()) do
+            if string.sub(name, 1, #objName) == objName then
+                model.values[name] = nil
+            end
+        end
+        model.sorted = false
+    end
+    return {response(hdr, "DelObjectResponse", 0, "<status>0</status>")}
+end
+
+local function control(cmd)
+    if cmd == "quit" then
+        return false
+    end
+    if string.match(cmd, "^reset") then
+        for key, value in string.gmatch(cmd, "(%a+)=(%d+)") do
+            if opts[key] ~= nil then
+                opts[key] = tonumber(value)
+            end
+        end
+        model_reset(opts.size)
+    end
+    return true
+end
+
+local sock = socket.udp()
+assert(sock:setsockname("127.0.0.1", opts.port))
+model_reset(opts.size)
+
+while true do
+    local data, addr, port = sock:receivefrom()
+    if data then
+        local cmd = string.match(data, "^MOCKEP (.*)$")
+        if cmd then
+            local running = control(cmd)
+            sock:sendto("OK", addr, port)
+            if not running then
+                break
+            end
+        elseif opts.loss == 0 or math.random(100) > opts.loss then
+            -- request is prefixed with 8 characters of flags
+            local req = string.sub(data, 9)
+            local hdr = {
+                callerId = string.match(req, "<callerId>(.-)</callerId>") or "0",
+                txaId    = string.match(req, "<txaId>(.-)</txaId>") or "0",
+            }
+            local msgType = string.match(req, "<msgType>(.-)</msgType>") or ""
+            local respAddr = string.match(req, "<respIpAddr>(.-)</respIpAddr>") or addr
+            local respPort = tonumber(string.match(req, "<respPort>(.-)</respPort>")) or port
+            local handler = handlers[msgType]
+            local datagrams = handler and handler(hdr, req) or
+                              {response(hdr, msgType .. "Response", 0, "")}
+
+            if opts.delay > 0 then
+                socket.sleep(opts.delay / 1000)
+            end
+            for _, datagram in ipairs(datagrams) do
+                sock:sendto(datagram, respAddr, respPort)
+            end
+        end
+    end
+end
+
+sock:close()
@@ -0,0 +1,393 @@
+/* mmx-frontapi-bulk.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Bulk AddObject/DelObject API: pipelining of requests to the Entry-point
+ */
+#include <errno.h>
+#include <sys/time.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-bulk.h"
+
+/* Fills in body of the request with index 'idx' */
+typedef int (*bulk_build_cb_t)(void *ctx, size_t idx, ep_message_t *msg);
+
+/* Called once for each request with its final status. 'msg' contains
+   the parsed response or NULL if the response was not received/parsed */
+typedef void (*bulk_done_cb_t)(void *ctx, size_t idx, int status,
+                               int respCode, ep_message_t *msg);
+
+typedef struct bulk_slot_s {
+    int            busy;
+    int            txaId;
+    size_t         idx;
+    struct timeval sent;
+} bulk_slot_t;
+
+static double bulk_elapsed(const struct timeval *from)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+    return (now.tv_sec - from->tv_sec) + 1e-6 * (now.tv_usec - from->tv_usec);
+}
+
+/*
+ * Sends 'count' requests keeping up to 'window' of them in flight and
+ * collects their responses. Transaction Id of request 'idx' is hdr->txaId + idx.
+ */
+static int bulk_pipeline(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                         size_t count, unsigned window,
+                         bulk_build_cb_t build, bulk_done_cb_t done, void *ctx)
+{
+    int status = FA_OK, res, hdr_stat;
+    unsigned i;
+    size_t next = 0, inflight = 0;
+    char buf[FA_BUF_SIZE];
+    char pool[FA_BUF_SIZE];
+    ep_packet_t *packet = (ep_packet_t *)buf;
+    ep_message_t msg;
+    ep_msg_header_t resp_hdr;
+    bulk_slot_t slots[MMXFA_BULK_MAX_WINDOW];
+
+    if (conn == NULL || hdr == NULL)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    if (window == 0 || window > MMXFA_BULK_MAX_WINDOW)
+        window = MMXFA_BULK_MAX_WINDOW;
+
+    memset(slots, 0, sizeof(slots));
+    mmx_frontapi_msg_struct_init(&msg, pool, sizeof(pool));
+
+    while (next < count || inflight > 0)
+    {
+        /* Fill in free slots of the window with new requests */
+        for (i = 0; i < window && next < count; i++)
+        {
+            if (slots[i].busy)
+                continue;
+
+            mmx_frontapi_msg_struct_reset(&msg);
+
+            msg.header = *hdr;
+            msg.header.txaId = hdr->txaId + (int)next;
+            msg.header.respMode = MMX_API_RESPMODE_SYNC;
+            msg.header.respCode = 0;
+            msg.header.moreFlag = 0;
+            msg.header.version = 0;
+            msg.header.delta = MMX_DELTA_FULL;
+            msg.header.fragment = 0;
+
+            if ((res = build(ctx, next, &msg)) != FA_OK)
+            {
+                done(ctx, next++, res, -1, NULL);
+                continue;
+            }
+
+            memset(packet->flags, 0, sizeof(packet->flags));
+            if (mmx_frontapi_message_build_ex(&msg, packet->msg,
+                          sizeof(buf) - sizeof(packet->flags) - 1, conn->path_dict) != FA_OK)
+            {
+                done(ctx, next++, FA_INVALID_FORMAT, -1, NULL);
+                continue;
+            }
+
+            if (mmx_send_packet(conn, packet, &msg.header) != 0)
+            {
+                done(ctx, next++, FA_GENERAL_ERROR, -1, NULL);
+                continue;
+            }
+
+            slots[i].busy = 1;
+            slots[i].txaId = msg.header.txaId;
+            slots[i].idx = next++;
+            gettimeofday(&slots[i].sent, NULL);
+            inflight++;
+        }
+
+        if (inflight == 0)
+            continue;
+
+        /* Wait for the next response (socket has receive timeout) */
+        res = recv(conn->sock, buf, sizeof(buf) - 1, 0);
+        if (res > 0)
+        {
+            MMX_STATS_COUNT(conn->stats, packets_received, 1);
+            MMX_STATS_COUNT(conn->stats, bytes_received, res);
+
+            buf[res] = '\0';
+            memset(&resp_hdr, 0, sizeof(resp_hdr));
+
+            hdr_stat = mmx_frontapi_msg_header_parse(buf, &resp_hdr);
+            MMX_TRACE_HDR(receive, MMX_TRACE_RECEIVE, &resp_hdr, (size_t)res, hdr_stat);
+            MMX_CAPTURE(conn, MMX_CAPTURE_DIR_RECEIVED, resp_hdr.txaId, buf, res);
+            if (hdr_stat == FA_OK)
+            {
+                /* Notification is not a response even if it has the awaited txaId */
+                i = window;
+                if (resp_hdr.msgType != MSGTYPE_NOTIFY)
+                    for (i = 0; i < window; i++)
+                        if (slots[i].busy && slots[i].txaId == resp_hdr.txaId)
+                            break;
+
+                if (i < window)
+                {
+                    MMX_TRACE_HDR(fragment, MMX_TRACE_FRAGMENT, &resp_hdr, (size_t)res,
+                                  (int)resp_hdr.moreFlag);
+
+                    /* Error responses may have no body - don't parse it */
+                    if (resp_hdr.respCode != 0)
+                        done(ctx, slots[i].idx, FA_OK, resp_hdr.respCode, NULL);
+                    else
+                    {
+                        mmx_frontapi_msg_struct_reset(&msg);
+                        if (mmx_frontapi_message_parse_ex(buf, &msg, conn->path_dict) == FA_OK)
+                            done(ctx, slots[i].idx, FA_OK, resp_hdr.respCode, &msg);
+                        else
+                            done(ctx, slots[i].idx, FA_INVALID_FORMAT, resp_hdr.respCode, NULL);
+                    }
+
+                    slots[i].busy = 0;
+                    inflight--;
+                }
+                else if (resp_hdr.msgType == MSGTYPE_NOTIFY && conn->notify)
+                    mmx_notify_input(conn, buf);
+                else
+                {
+                    ing_log(LOG_DEBUG, "Bulk request: discard response with txaId %d\n",
+                            resp_hdr.txaId);
+                    MMX_STATS_COUNT(conn->stats, discarded, 1);
+                    MMX_TRACE_HDR(discard, MMX_TRACE_DISCARD, &resp_hdr, (size_t)res, hdr_stat);
+                }
+            }
+            else
+            {
+                MMX_STATS_COUNT(conn->stats, discarded, 1);
+                MMX_TRACE_HDR(discard, MMX_TRACE_DISCARD, &resp_hdr, (size_t)res, hdr_stat);
+            }
+        }
+        else if (res < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            perror("Could not receive answer from Entry point");
+
+        /* Give up requests whose response was not received in time */
+        for (i = 0; i < window; i++)
+        {
+            if (slots[i].busy && bulk_elapsed(&slots[i].sent) >= conn->sock_timeout)
+            {
+                ing_log(LOG_ERR, "Bulk request: no response for txaId %d\n", slots[i].txaId);
+                MMX_STATS_COUNT(conn->stats, timeouts, 1);
+                MMX_TRACE(timeout, MMX_TRACE_TIMEOUT, slots[i].txaId, 0, 0, 0, 1);
+                done(ctx, slots[i].idx, FA_GENERAL_ERROR, -1, NULL);
+                slots[i].busy = 0;
+                inflight--;
+            }
+        }
+    }
+
+ret:
+    return status;
+}
+
+static int bulk_addobj_build(void *ctx, size_t idx, ep_message_t *msg)
+{
+    const mmx_bulk_addobj_t *obj = (mmx_bulk_addobj_t *)ctx + idx;
+    uint32_t i;
+    int res;
+
+    if (obj->objName == NULL || obj->arraySize > MSG_MAX_NUMBER_OF_ADDOBJ_PARAMS ||
+        (obj->arraySize > 0 && obj->paramValues == NULL))
+        return FA_BAD_INPUT_PARAMS;
+
+    msg->header.msgType = MSGTYPE_ADDOBJECT;
+    strcpy_safe(msg->body.addObject.objName, obj->objName,
+                sizeof(msg->body.addObject.objName));
+    msg->body.addObject.arraySize = obj->arraySize;
+
+    for (i = 0; i < obj->arraySize; i++)
+    {
+        res = mmx_frontapi_msgstruct_insert_nvpair(msg, &msg->body.addObject.paramValues[i],
+                                                   (char *)obj->paramValues[i].name,
+                                                   obj->paramValues[i].pValue);
+        if (res != FA_OK)
+            return res;
+    }
+
+    return FA_OK;
+}
+
+static void bulk_addobj_done(void *ctx, size_t idx, int status, int respCode, ep_message_t *msg)
+{
+    mmx_bulk_addobj_t *obj = (mmx_bulk_addobj_t *)ctx + idx;
+
+    obj->status = status;
+    obj->respCode = respCode;
+    obj->instanceNumber = 0;
+
+    if (msg != NULL && msg->header.msgType == MSGTYPE_ADDOBJECT_RESP)
+        obj->instanceNumber = msg->body.addObjectResponse.instanceNumber;
+}
+
+int mmx_frontapi_bulk_add_objects(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                                  mmx_bulk_addobj_t *objs, size_t count, unsigned window)
+{
+    int status = FA_OK;
+    size_t i;
+
+    if (objs == NULL && count > 0)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    status = bulk_pipeline(conn, hdr, count, window,
+                           bulk_addobj_build, bulk_addobj_done, objs);
+    if (status != FA_OK)
+        goto ret;
+
+    for (i = 0; i < count; i++)
+    {
+        if (objs[i].status != FA_OK || objs[i].respCode != 0)
+        {
+            status = FA_GENERAL_ERROR;
+            break;
+        }
+    }
+
+ret:
+    return status;
+}
+
+typedef struct bulk_delobj_ctx_s {
+    const char *const *objects;
+    size_t            count;
+    int               *respCodes;
+    int               failed;
+} bulk_delobj_ctx_t;
+
+static int bulk_delobj_build(void *ctx, size_t idx, ep_message_t *msg)
+{
+    bulk_delobj_ctx_t *del = (bulk_delobj_ctx_t *)ctx;
+    size_t first = idx * MSG_MAX_NUMBER_OF_DELOBJ_PARAMS, i;
+
+    msg->header.msgType = MSGTYPE_DELOBJECT;
+    msg->body.delObject.arraySize = 0;
+
+    for (i = first; i < del->count && i < first + MSG_MAX_NUMBER_OF_DELOBJ_PARAMS; i++)
+    {
+        if (del->objects[i] == NULL)
+            return FA_BAD_INPUT_PARAMS;
+
+        strcpy_safe(msg->body.delObject.objects[msg->body.delObject.arraySize++],
+                    del->objects[i], MSG_MAX_STR_LEN);
+    }
+
+    return FA_OK;
+}
+
+static void bulk_delobj_done(void *ctx, size_t idx, int status, int respCode, ep_message_t *msg)
+{
+    bulk_delobj_ctx_t *del = (bulk_delobj_ctx_t *)ctx;
+    size_t first = idx * MSG_MAX_NUMBER_OF_DELOBJ_PARAMS, i;
+
+    if (status != FA_OK)
+        respCode = -1;
+
+    if (respCode != 0)
+        del->failed = 1;
+
+    if (del->respCodes == NULL)
+        return;
+
+    for (i = first; i < del->count && i < first + MSG_MAX_NUMBER_OF_DELOBJ_PARAMS; i++)
+        del->respCodes[i] = respCode;
+}
+
+int mmx_frontapi_bulk_del_objects(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                                  const char *const *objects, size_t count,
+                                  unsigned window, int *respCodes)
+{
+    int status = FA_OK;
+    bulk_delobj_ctx_t del;
+
+    if (objects == NULL && count > 0)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    del.objects = objects;
+    del.count = count;
+    del.respCodes = respCodes;
+    del.failed = 0;
+
+    status = bulk_pipeline(conn, hdr, (count + MSG_MAX_NUMBER_OF_DELOBJ_PARAMS - 1) /
+                                      MSG_MAX_NUMBER_OF_DELOBJ_PARAMS,
+                           window, bulk_delobj_build, bulk_delobj_done, &del);
+
+    if (status == FA_OK && del.failed)
+        status = FA_GENERAL_ERROR;
+
+ret:
+    return status;
+}
@@ -0,0 +1,122 @@
+/* mmx-frontapi-bulk.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Bulk AddObject/DelObject API.
+ * Requests are pipelined to the Entry-point: up to 'window' requests are kept
+ * in flight on the connection and responses are matched by transaction Id.
+ */
+
+#ifndef MMX_FRONTAPI_BULK_H_
+#define MMX_FRONTAPI_BULK_H_
+
+#include "mmx-frontapi.h"
+
+/* Max number of requests that may be in flight at the same time */
+#define MMXFA_BULK_MAX_WINDOW  16
+
+/*
+ * Element of the bulk AddObject request: one object instance to be created
+ */
+typedef struct mmx_bulk_addobj_s {
+    /* Input */
+    const char      *objName;      /* Object name without instance number (ending by ".") */
+    uint32_t        arraySize;     /* Number of initial parameter values */
+    const nvpair_t  *paramValues;  /* Initial parameter values (names w/o object path) */
+
+    /* Output */
+    int             status;        /* FA_OK if response was received, otherwise FA_* error */
+    int             respCode;      /* resCode of the Entry-point response */
+    uint32_t        instanceNumber;/* Number of the created instance */
+} mmx_bulk_addobj_t;
+
+/*
+ * Creates 'count' object instances described by 'objs' array.
+ * Header fields of all requests (callerId, respPort, etc.) are taken from 'hdr',
+ * transaction Ids are assigned sequentially starting from hdr->txaId.
+ * Results are written to 'objs' in the order of the input array.
+ * Returns FA_OK if all objects were created, FA_GENERAL_ERROR if at least one
+ * request failed (see status/respCode of each element), or other FA_* error.
+ */
+int mmx_frontapi_bulk_add_objects(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                                  mmx_bulk_addobj_t *objs, size_t count, unsigned window);
+
+/*
+ * Deletes 'count' object instances. Object names are packed into DelObject
+ * requests of up to MSG_MAX_NUMBER_OF_DELOBJ_PARAMS names that are pipelined
+ * the same way as in the bulk AddObject API.
+ * If 'respCodes' is not NULL, it is filled with resCode of the request
+ * that carried each object (or -1 if no response was received).
+ * Returns FA_OK if all objects were deleted, FA_GENERAL_ERROR if at least one
+ * request failed, or other FA_* error.
+ */
+int mmx_frontapi_bulk_del_objects(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                                  const char *const *objects, size_t count,
+                                  unsigned window, int *respCodes);
+
+#endif /* MMX_FRONTAPI_BULK_H_ */
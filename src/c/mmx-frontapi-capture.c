@@ -0,0 +1,247 @@
+/* mmx-frontapi-capture.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Capture of Entry-point traffic to a memory-mapped log
+ */
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-capture.h"
+
+#define CAPTURE_HDR_SIZE \
+    ((sizeof(mmx_capture_file_hdr_t) + MMX_CAPTURE_ALIGN - 1) & ~(size_t)(MMX_CAPTURE_ALIGN - 1))
+
+static int capture_map(mmx_capture_t *cap, int fd, size_t size, int writable)
+{
+    void *addr = mmap(NULL, size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                      MAP_SHARED, fd, 0);
+
+    if (addr == MAP_FAILED)
+        return FA_GENERAL_ERROR;
+
+    cap->fd = fd;
+    cap->writable = writable;
+    cap->size = size;
+    cap->hdr = (mmx_capture_file_hdr_t *)addr;
+    return FA_OK;
+}
+
+int mmx_capture_open(mmx_capture_t *cap, const char *path, size_t size)
+{
+    int status = FA_OK;
+    int fd = -1;
+
+    if (cap == NULL || path == NULL || size < CAPTURE_HDR_SIZE + MMX_CAPTURE_REC_SPACE(0))
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not create capture file %s", path);
+
+    if (ftruncate(fd, (off_t)size) != 0)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not set size of capture file %s", path);
+
+    if (capture_map(cap, fd, size, 1) != FA_OK)
+        GOTO_RET_WITH_ERROR(FA_NOT_ENOUGH_MEMORY, "Could not map capture file %s", path);
+
+    memcpy(cap->hdr->magic, MMX_CAPTURE_MAGIC, sizeof(cap->hdr->magic));
+    cap->hdr->version = MMX_CAPTURE_VERSION;
+    cap->hdr->hdr_size = CAPTURE_HDR_SIZE;
+    cap->hdr->size = size;
+    cap->hdr->used = CAPTURE_HDR_SIZE;
+
+ret:
+    if (status != FA_OK && fd >= 0)
+        close(fd);
+    return status;
+}
+
+int mmx_capture_load(mmx_capture_t *cap, const char *path)
+{
+    int status = FA_OK;
+    int fd = -1;
+    struct stat st;
+    const mmx_capture_file_hdr_t *hdr;
+
+    if (cap == NULL || path == NULL)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not open capture file %s", path);
+
+    if ((size_t)st.st_size < CAPTURE_HDR_SIZE)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Capture file %s is too short", path);
+
+    if (capture_map(cap, fd, (size_t)st.st_size, 0) != FA_OK)
+        GOTO_RET_WITH_ERROR(FA_NOT_ENOUGH_MEMORY, "Could not map capture file %s", path);
+
+    hdr = cap->hdr;
+    if (memcmp(hdr->magic, MMX_CAPTURE_MAGIC, sizeof(hdr->magic)) ||
+        hdr->version != MMX_CAPTURE_VERSION || hdr->hdr_size < sizeof(*hdr))
+    {
+        munmap(cap->hdr, cap->size);
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "%s is not a capture file", path);
+    }
+
+ret:
+    if (status != FA_OK && fd >= 0)
+        close(fd);
+    return status;
+}
+
+int mmx_capture_close(mmx_capture_t *cap)
+{
+    uint64_t used;
+
+    if (cap == NULL || cap->hdr == NULL)
+        return FA_BAD_INPUT_PARAMS;
+
+    used = __atomic_load_n(&cap->hdr->used, __ATOMIC_ACQUIRE);
+    if (used > cap->size)
+        used = cap->size;
+
+    if (cap->writable)
+    {
+        cap->hdr->size = used;
+        cap->hdr->used = used;
+        msync(cap->hdr, cap->size, MS_SYNC);
+    }
+    munmap(cap->hdr, cap->size);
+
+    if (cap->writable && ftruncate(cap->fd, (off_t)used) != 0)
+        ing_log(LOG_ERR, "Could not truncate capture file\n");
+
+    close(cap->fd);
+    cap->hdr = NULL;
+    return FA_OK;
+}
+
+void mmx_capture_write(mmx_capture_t *cap, int dir, int stream, int txaId,
+                       const void *data, size_t len)
+{
+    mmx_capture_file_hdr_t *hdr = cap->hdr;
+    mmx_capture_rec_t *rec;
+    struct timespec ts;
+    uint64_t space = MMX_CAPTURE_REC_SPACE(len);
+    uint64_t offset = __atomic_fetch_add(&hdr->used, space, __ATOMIC_RELAXED);
+
+    if (offset + space > cap->size)
+    {
+        __atomic_fetch_add(&hdr->dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    rec = (mmx_capture_rec_t *)((char *)hdr + offset);
+    rec->len = (uint32_t)len;
+    rec->txaId = txaId;
+    rec->dir = (uint16_t)dir;
+    rec->reserved = 0;
+    rec->stream = stream;
+    memcpy(rec + 1, data, len);
+
+    /* Time is written last: it marks the record complete for readers */
+    clock_gettime(CLOCK_REALTIME, &ts);
+    __atomic_store_n(&rec->ts_ns, (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec,
+                     __ATOMIC_RELEASE);
+    __atomic_fetch_add(&hdr->records, 1, __ATOMIC_RELAXED);
+}
+
+const mmx_capture_rec_t *mmx_capture_next(const mmx_capture_t *cap,
+                                          const mmx_capture_rec_t *rec)
+{
+    const char *base = (const char *)cap->hdr;
+    uint64_t offset, end = __atomic_load_n(&cap->hdr->used, __ATOMIC_ACQUIRE);
+
+    if (end > cap->size)
+        end = cap->size;
+
+    offset = rec ? (uint64_t)((const char *)rec - base) + MMX_CAPTURE_REC_SPACE(rec->len)
+                 : cap->hdr->hdr_size;
+    if (offset + sizeof(mmx_capture_rec_t) > end)
+        return NULL;
+
+    rec = (const mmx_capture_rec_t *)(base + offset);
+    if (__atomic_load_n(&rec->ts_ns, __ATOMIC_ACQUIRE) == 0 ||
+        offset + MMX_CAPTURE_REC_SPACE(rec->len) > end)
+        return NULL;
+
+    return rec;
+}
+
+void mmx_frontapi_set_capture(mmx_ep_connection_t *conn, mmx_capture_t *cap)
+{
+    conn->capture = cap;
+}
@@ -0,0 +1,173 @@
+/* mmx-frontapi-capture.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Capture of Entry-point traffic.
+ *
+ * Every packet sent or received by the connections with attached capture
+ * is appended to a log file together with its time, direction, txaId and
+ * the connection it belongs to. The file has fixed size, is mapped into
+ * memory and may be shared by connections of several threads (records
+ * are reserved by an atomic addition, no locks are taken). When the file
+ * is full further packets are counted as dropped.
+ *
+ * The log is read by mapping it as well (mmx_capture_load and
+ * mmx_capture_next), e.g. by bench/c/mmx-replay which replays it as the
+ * client or as the Entry-point.
+ *
+ * File layout: mmx_capture_file_hdr_t, then records; every record is
+ * mmx_capture_rec_t followed by the packet bytes padded to 8 bytes.
+ * All fields are in host byte order.
+ */
+
+#ifndef MMX_FRONTAPI_CAPTURE_H_
+#define MMX_FRONTAPI_CAPTURE_H_
+
+#include <stdint.h>
+#include "mmx-frontapi.h"
+
+#define MMX_CAPTURE_MAGIC       "MMXCAP1"
+#define MMX_CAPTURE_VERSION     1
+
+/* Direction of the packet */
+#define MMX_CAPTURE_DIR_SENT       0   /* request sent to the Entry-point */
+#define MMX_CAPTURE_DIR_RECEIVED   1   /* response received from the Entry-point */
+
+/* Records are aligned to this size */
+#define MMX_CAPTURE_ALIGN       8
+#define MMX_CAPTURE_REC_SPACE(len) \
+    (sizeof(mmx_capture_rec_t) + (((len) + MMX_CAPTURE_ALIGN - 1) & ~(size_t)(MMX_CAPTURE_ALIGN - 1)))
+
+typedef struct mmx_capture_file_hdr_s {
+    char     magic[8];
+    uint32_t version;
+    uint32_t hdr_size;     /* Offset of the first record */
+    uint64_t size;         /* Size of the file */
+    uint64_t used;         /* Offset of the next record (may exceed size if full) */
+    uint64_t records;
+    uint64_t dropped;      /* Packets not written because the file is full */
+} mmx_capture_file_hdr_t;
+
+typedef struct mmx_capture_rec_s {
+    uint64_t ts_ns;        /* CLOCK_REALTIME, 0 - the record is not written yet */
+    uint32_t len;          /* Number of packet bytes */
+    int32_t  txaId;        /* 0 - unknown (packet could not be parsed) */
+    uint16_t dir;          /* MMX_CAPTURE_DIR_... */
+    uint16_t reserved;
+    int32_t  stream;       /* Connection of the packet (its socket descriptor) */
+} mmx_capture_rec_t;
+
+struct mmx_capture_s {
+    int fd;
+    int writable;
+    size_t size;
+    mmx_capture_file_hdr_t *hdr;
+};
+
+/*
+ * Creates (truncates) the capture file of 'size' bytes and maps it for writing
+ */
+int mmx_capture_open(mmx_capture_t *cap, const char *path, size_t size);
+
+/*
+ * Maps the existing capture file for reading
+ */
+int mmx_capture_load(mmx_capture_t *cap, const char *path);
+
+/*
+ * Unmaps the file. The written file is truncated to its used part.
+ */
+int mmx_capture_close(mmx_capture_t *cap);
+
+/*
+ * Appends the packet to the capture
+ */
+void mmx_capture_write(mmx_capture_t *cap, int dir, int stream, int txaId,
+                       const void *data, size_t len);
+
+/*
+ * Returns the record following 'rec' (the first record if 'rec' is NULL)
+ * or NULL if there are no more complete records
+ */
+const mmx_capture_rec_t *mmx_capture_next(const mmx_capture_t *cap,
+                                          const mmx_capture_rec_t *rec);
+
+/* Packet bytes of the record */
+static inline const char *mmx_capture_data(const mmx_capture_rec_t *rec)
+{
+    return (const char *)(rec + 1);
+}
+
+/*
+ * Attaches the capture to the connection: packets sent by
+ * mmx_frontapi_send_req/mmx_frontapi_make_request and received by
+ * mmx_frontapi_receive_resp will be written to it. NULL stops capturing.
+ */
+void mmx_frontapi_set_capture(mmx_ep_connection_t *conn, mmx_capture_t *cap);
+
+#endif /* MMX_FRONTAPI_CAPTURE_H_ */
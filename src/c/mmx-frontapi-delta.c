@@ -0,0 +1,284 @@
+/* mmx-frontapi-delta.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Delta GetParamValue - cache of values merged from full and delta responses
+ */
+#include <string.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-delta.h"
+
+/* Slot of a value: capacity (with '\0') followed by the value itself */
+typedef struct delta_slot_s {
+    uint32_t capacity;
+} delta_slot_t;
+
+#define DELTA_ALIGN(x)       (((x) + 7) & ~7u)
+#define DELTA_SLOT(c, off)   ((delta_slot_t *)((c)->values + (off)))
+#define DELTA_VALUE(slot)    ((char *)(slot) + sizeof(delta_slot_t))
+
+typedef struct delta_walk_s {
+    const mmx_delta_cache_t *cache;
+    mmx_delta_cache_cb_t cb;
+    void *ctx;
+} delta_walk_t;
+
+int mmx_delta_cache_init(mmx_delta_cache_t *cache, char *names_buff, uint32_t names_size,
+                         char *values_buff, uint32_t values_size)
+{
+    int status = FA_OK;
+
+    if (cache == NULL || values_buff == NULL || values_size == 0)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    memset(cache, 0, sizeof(*cache));
+    if ((status = mmx_name_tree_init(&cache->names, names_buff, names_size)) != FA_OK)
+        goto ret;
+    cache->values = values_buff;
+    cache->values_size = values_size;
+
+ret:
+    return status;
+}
+
+void mmx_delta_cache_clear(mmx_delta_cache_t *cache)
+{
+    mmx_name_tree_init(&cache->names, cache->names.mem, cache->names.size);
+    cache->values_used = 0;
+    cache->version = 0;
+}
+
+/* Stores the value in place if it fits, otherwise to a new slot */
+static int delta_store(mmx_delta_cache_t *cache, const char *name, const char *value)
+{
+    size_t len = strlen(value) + 1;
+    delta_slot_t *slot;
+    uint32_t off, need;
+
+    if (mmx_name_tree_find(&cache->names, name, &off) == FA_OK)
+    {
+        slot = DELTA_SLOT(cache, off);
+        if (len <= slot->capacity)
+        {
+            memcpy(DELTA_VALUE(slot), value, len);
+            return FA_OK;
+        }
+    }
+
+    /* The old slot of the grown value is not reused until the cache is cleared */
+    need = DELTA_ALIGN(sizeof(delta_slot_t) + len);
+    if (cache->values_size - cache->values_used < need)
+        return FA_NOT_ENOUGH_MEMORY;
+
+    off = cache->values_used;
+    slot = DELTA_SLOT(cache, off);
+    slot->capacity = need - sizeof(delta_slot_t);
+    memcpy(DELTA_VALUE(slot), value, len);
+
+    if (mmx_name_tree_insert(&cache->names, name, off) != FA_OK)
+        return FA_NOT_ENOUGH_MEMORY;
+    cache->values_used += need;
+
+    return FA_OK;
+}
+
+int mmx_delta_cache_merge(mmx_delta_cache_t *cache, const ep_message_t *response, int first)
+{
+    int status = FA_OK;
+    const ep_getParamValue_resp_t *body;
+    const nvpair_t *pair;
+    uint32_t i;
+
+    if (cache == NULL || response == NULL ||
+        response->header.msgType != MSGTYPE_GETVALUE_RESP ||
+        response->header.respCode != MMX_API_RC_OK)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    body = &response->body.getParamValueResponse;
+
+    if (first)
+    {
+        cache->failed = 0;
+        cache->incomplete = 0;
+        cache->fragments = 0;
+        switch (response->header.delta)
+        {
+        case MMX_DELTA_CHANGES:
+            cache->changes++;
+            break;
+        case MMX_DELTA_NOT_MODIFIED:
+            cache->not_modified++;
+            break;
+        default:
+            /* All values: parameters removed since the last request are dropped */
+            mmx_delta_cache_clear(cache);
+            cache->full++;
+            break;
+        }
+    }
+
+    if (response->header.delta == MMX_DELTA_CHANGES)
+        cache->changed_values += body->arraySize;
+
+    /*
+     * Values of the fragments before a lost one are not enough for the new
+     * version: the cache is valid for no version until all values are sent
+     */
+    cache->fragments++;
+    if (!cache->incomplete && response->header.version != 0 &&
+        (response->header.fragment != 0 ? response->header.fragment != cache->fragments :
+                                          cache->fragments != 1 || response->header.moreFlag))
+    {
+        cache->incomplete = 1;
+        cache->incomplete_responses++;
+        cache->version = 0;
+    }
+
+    for (i = 0; i < body->arraySize && !cache->failed; i++)
+    {
+        pair = &body->paramValues[i];
+        if (delta_store(cache, pair->name, pair->pValue ? pair->pValue : "") != FA_OK)
+        {
+            cache->failed = 1;
+            cache->version = 0;
+            GOTO_RET_WITH_ERROR(FA_NOT_ENOUGH_MEMORY, "Delta cache is full (%u values)",
+                                cache->names.count);
+        }
+    }
+
+    /* The cache gets the new version when all fragments are merged */
+    if (!response->header.moreFlag && !cache->failed && !cache->incomplete)
+        cache->version = response->header.version;
+
+ret:
+    return status;
+}
+
+const char *mmx_delta_cache_get(const mmx_delta_cache_t *cache, const char *name)
+{
+    uint32_t off;
+
+    if (mmx_name_tree_find(&cache->names, name, &off) != FA_OK)
+        return NULL;
+    return DELTA_VALUE(DELTA_SLOT(cache, off));
+}
+
+static int delta_walk_cb(const char *name, uint32_t value, void *ctx)
+{
+    delta_walk_t *walk = ctx;
+
+    return walk->cb(name, DELTA_VALUE(DELTA_SLOT(walk->cache, value)), walk->ctx);
+}
+
+int mmx_delta_cache_foreach(const mmx_delta_cache_t *cache, const char *prefix,
+                            mmx_delta_cache_cb_t cb, void *ctx)
+{
+    delta_walk_t walk = { cache, cb, ctx };
+
+    return mmx_name_tree_foreach(&cache->names, prefix, delta_walk_cb, &walk);
+}
+
+int mmx_delta_cache_make_request(mmx_ep_connection_t *conn, mmx_delta_cache_t *cache,
+                                 ep_message_t *msg)
+{
+    int status = FA_OK;
+    char buf[MMXFA_MAX_DATAGRAM_SIZE];
+    int txaId, more = 0, first = 1;
+    size_t rcvd;
+
+    if (conn == NULL || cache == NULL || msg == NULL ||
+        msg->header.msgType != MSGTYPE_GETVALUE)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    txaId = msg->header.txaId;
+    msg->header.version = cache->version;
+    msg->header.delta = MMX_DELTA_FULL;
+
+    if ((status = mmx_frontapi_make_request(conn, msg, &more)) != FA_OK)
+        goto ret;
+
+    while (msg->header.respCode == MMX_API_RC_OK)
+    {
+        if ((status = mmx_delta_cache_merge(cache, msg, first)) != FA_OK || !more)
+            goto ret;
+        first = 0;
+
+        if (mmx_frontapi_receive_resp(conn, txaId, buf, sizeof(buf) - 1, &rcvd) != 0)
+            GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "No response from Entry point (txaId %d)", txaId);
+
+        mmx_frontapi_msg_struct_reset(msg);
+        if ((status = mmx_frontapi_message_parse_ex(buf, msg, conn->path_dict)) != FA_OK)
+            goto ret;
+        more = msg->header.moreFlag;
+    }
+
+ret:
+    return status;
+}
@@ -0,0 +1,168 @@
+/* mmx-frontapi-delta.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Delta GetParamValue.
+ *
+ * Periodic GetParamValue requests of large subtrees mostly return the
+ * same values. A request may carry the version of the values the client
+ * already has (<version> header tag); the Entry-point then answers with:
+ *  - MMX_DELTA_CHANGES - only the values changed since that version,
+ *  - MMX_DELTA_NOT_MODIFIED - no values at all,
+ *  - MMX_DELTA_FULL - all values, e.g. if the version is unknown to it
+ *    or parameters were removed since then.
+ * Every response carries the current version of the values; fragments of
+ * a fragmented response are numbered from 1 (<fragment> header tag).
+ * Entry-points that do not support versions ignore the tag and send all
+ * values.
+ *
+ * The delta cache keeps the result of one request (the same list of
+ * parameter names every time) and merges the responses into it:
+ *     mmx_delta_cache_init(&cache, names_buf, sizeof(names_buf), values_buf, sizeof(values_buf));
+ *     ...fill GetParamValue request...
+ *     mmx_delta_cache_make_request(conn, &cache, &msg);
+ *     value = mmx_delta_cache_get(&cache, "Device.IP.Interface.1.Stats.BytesSent");
+ *
+ * Names are kept in a name tree and values in a separate buffer, both
+ * supplied by the caller. Changed values are overwritten in place if they
+ * fit, so the value buffer should have room for values that grow.
+ */
+
+#ifndef MMX_FRONTAPI_DELTA_H_
+#define MMX_FRONTAPI_DELTA_H_
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-nametree.h"
+
+typedef struct mmx_delta_cache_s {
+    uint32_t version;          /* Version of the cached values, 0 - not complete */
+    int      failed;           /* a fragment of the current response was not merged */
+    int      incomplete;       /* a fragment of the current response was lost or reordered */
+    uint16_t fragments;        /* fragments of the current response merged so far */
+    mmx_name_tree_t names;     /* Name -> offset of the value */
+    char     *values;          /* Memory buffer supplied by the caller */
+    uint32_t values_size;
+    uint32_t values_used;
+
+    /* Counters of the responses */
+    uint64_t full;
+    uint64_t changes;
+    uint64_t not_modified;
+    uint64_t changed_values;   /* values received in MMX_DELTA_CHANGES responses */
+    uint64_t incomplete_responses; /* responses with lost or reordered fragments */
+} mmx_delta_cache_t;
+
+/*
+ * Iteration callback. Non-zero return value stops the iteration.
+ */
+typedef int (*mmx_delta_cache_cb_t)(const char *name, const char *value, void *ctx);
+
+/*
+ * Initializes an empty cache in the specified memory buffers
+ */
+int mmx_delta_cache_init(mmx_delta_cache_t *cache, char *names_buff, uint32_t names_size,
+                         char *values_buff, uint32_t values_size);
+
+/*
+ * Drops all cached values (the next request gets all values)
+ */
+void mmx_delta_cache_clear(mmx_delta_cache_t *cache);
+
+/*
+ * Merges parsed GetParamValueResponse fragment into the cache. 'first' -
+ * the first received fragment of the response. The version of the cache
+ * is updated by the last fragment if all fragments were merged in order;
+ * if one was lost or reordered, the version is reset, so the next request
+ * gets all values again.
+ * Returns FA_NOT_ENOUGH_MEMORY if a buffer is exhausted; the version of
+ * the cache is then reset as well.
+ */
+int mmx_delta_cache_merge(mmx_delta_cache_t *cache, const ep_message_t *response, int first);
+
+/*
+ * Returns the cached value of the parameter or NULL
+ */
+const char *mmx_delta_cache_get(const mmx_delta_cache_t *cache, const char *name);
+
+/*
+ * Calls 'cb' for every cached parameter whose name starts with 'prefix'
+ * (NULL or "" - for all) in lexicographical order
+ */
+int mmx_delta_cache_foreach(const mmx_delta_cache_t *cache, const char *prefix,
+                            mmx_delta_cache_cb_t cb, void *ctx);
+
+/*
+ * Sends GetParamValue request 'msg' with the version of the cache,
+ * receives all response fragments and merges them into the cache.
+ * 'msg' receives the last fragment; the request with error response code
+ * does not change the cache.
+ */
+int mmx_delta_cache_make_request(mmx_ep_connection_t *conn, mmx_delta_cache_t *cache,
+                                 ep_message_t *msg);
+
+#endif /* MMX_FRONTAPI_DELTA_H_ */
@@ -0,0 +1,387 @@
+/* mmx-frontapi-export.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Streaming export of parameter values received from the Entry-point
+ */
+#include <errno.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-export.h"
+
+#define EXPORT_OUT_BUF_SIZE  4096
+
+/* Buffered output to the user callback */
+typedef struct export_out_s {
+    mmx_export_write_cb_t write_cb;
+    void                  *ctx;
+    int                   err;
+    size_t                len;
+    char                  data[EXPORT_OUT_BUF_SIZE];
+} export_out_t;
+
+/* All buffers needed for the export: allocated once, size does not depend
+   on the size of the exported tree */
+typedef struct export_state_s {
+    export_out_t out;
+    char         prev_name[NVP_MAX_NAME_LEN];
+    char         buf[MMXFA_MAX_DATAGRAM_SIZE];
+    char         pool[MMXFA_MAX_DATAGRAM_SIZE];
+    ep_message_t msg;
+} export_state_t;
+
+static void out_flush(export_out_t *out)
+{
+    if (out->len > 0 && !out->err)
+        out->err = out->write_cb(out->ctx, out->data, out->len);
+    out->len = 0;
+}
+
+static void out_write(export_out_t *out, const char *data, size_t len)
+{
+    size_t n;
+
+    while (len > 0 && !out->err)
+    {
+        if (out->len == sizeof(out->data))
+            out_flush(out);
+
+        n = sizeof(out->data) - out->len;
+        if (n > len)
+            n = len;
+
+        memcpy(out->data + out->len, data, n);
+        out->len += n;
+        data += n;
+        len -= n;
+    }
+}
+
+static void out_puts(export_out_t *out, const char *str)
+{
+    out_write(out, str, strlen(str));
+}
+
+static void out_varint(export_out_t *out, size_t value)
+{
+    char buf[16];
+    size_t n = 0;
+
+    do {
+        buf[n] = value & 0x7f;
+        value >>= 7;
+        if (value)
+            buf[n] |= 0x80;
+        n++;
+    } while (value);
+
+    out_write(out, buf, n);
+}
+
+static void out_xml_escaped(export_out_t *out, const char *str)
+{
+    const char *p;
+
+    for (p = str; *p; p++)
+    {
+        switch (*p)
+        {
+        case '<':  out_write(out, str, p - str); out_puts(out, "&lt;");   str = p + 1; break;
+        case '>':  out_write(out, str, p - str); out_puts(out, "&gt;");   str = p + 1; break;
+        case '&':  out_write(out, str, p - str); out_puts(out, "&amp;");  str = p + 1; break;
+        case '"':  out_write(out, str, p - str); out_puts(out, "&quot;"); str = p + 1; break;
+        default: break;
+        }
+    }
+    out_write(out, str, p - str);
+}
+
+static void out_json_escaped(export_out_t *out, const char *str)
+{
+    const char *p;
+    char buf[8];
+
+    for (p = str; *p; p++)
+    {
+        if (*p != '"' && *p != '\\' && (unsigned char)*p >= 0x20)
+            continue;
+
+        out_write(out, str, p - str);
+        str = p + 1;
+
+        switch (*p)
+        {
+        case '"':  out_puts(out, "\\\""); break;
+        case '\\': out_puts(out, "\\\\"); break;
+        case '\n': out_puts(out, "\\n");  break;
+        case '\r': out_puts(out, "\\r");  break;
+        case '\t': out_puts(out, "\\t");  break;
+        default:
+            sprintf(buf, "\\u%04x", (unsigned char)*p);
+            out_puts(out, buf);
+            break;
+        }
+    }
+    out_write(out, str, p - str);
+}
+
+static void export_begin(export_state_t *st, mmx_export_format_t format, const char *path)
+{
+    char version = MMX_EXPORT_BIN_VERSION;
+
+    switch (format)
+    {
+    case MMX_EXPORT_FORMAT_XML:
+        out_puts(&st->out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<" MSG_STR_PARAMVALUES " "
+                           MSG_STR_PATHNAME "=\"");
+        out_xml_escaped(&st->out, path);
+        out_puts(&st->out, "\">\n");
+        break;
+    case MMX_EXPORT_FORMAT_BINARY:
+        out_write(&st->out, MMX_EXPORT_BIN_MAGIC, sizeof(MMX_EXPORT_BIN_MAGIC));
+        out_write(&st->out, &version, 1);
+        break;
+    default:
+        break;
+    }
+}
+
+static void export_pair(export_state_t *st, mmx_export_format_t format,
+                        const char *name, const char *value)
+{
+    size_t shared = 0, name_len;
+
+    switch (format)
+    {
+    case MMX_EXPORT_FORMAT_XML:
+        out_puts(&st->out, "  <" MSG_STR_NAMEVALUEPAIR "><" MSG_STR_NAME ">");
+        out_xml_escaped(&st->out, name);
+        out_puts(&st->out, "</" MSG_STR_NAME "><" MSG_STR_VALUE ">");
+        out_xml_escaped(&st->out, value);
+        out_puts(&st->out, "</" MSG_STR_VALUE "></" MSG_STR_NAMEVALUEPAIR ">\n");
+        break;
+    case MMX_EXPORT_FORMAT_JSONL:
+        out_puts(&st->out, "{\"" MSG_STR_NAME "\":\"");
+        out_json_escaped(&st->out, name);
+        out_puts(&st->out, "\",\"" MSG_STR_VALUE "\":\"");
+        out_json_escaped(&st->out, value);
+        out_puts(&st->out, "\"}\n");
+        break;
+    case MMX_EXPORT_FORMAT_BINARY:
+        while (st->prev_name[shared] && st->prev_name[shared] == name[shared])
+            shared++;
+        name_len = strlen(name);
+        out_varint(&st->out, shared);
+        out_varint(&st->out, name_len - shared);
+        out_write(&st->out, name + shared, name_len - shared);
+        out_varint(&st->out, strlen(value));
+        out_puts(&st->out, value);
+        strcpy_safe(st->prev_name, name, sizeof(st->prev_name));
+        break;
+    }
+}
+
+static void export_end(export_state_t *st, mmx_export_format_t format)
+{
+    switch (format)
+    {
+    case MMX_EXPORT_FORMAT_XML:
+        out_puts(&st->out, "</" MSG_STR_PARAMVALUES ">\n");
+        break;
+    case MMX_EXPORT_FORMAT_BINARY:
+        out_varint(&st->out, 0);
+        out_varint(&st->out, 0);
+        break;
+    default:
+        break;
+    }
+    out_flush(&st->out);
+}
+
+int mmx_frontapi_export(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                        const char *path, int configOnly, mmx_export_format_t format,
+                        mmx_export_write_cb_t write_cb, void *ctx, size_t *exported)
+{
+    int status = FA_OK, res, more = 1;
+    size_t rcvd = 0, count = 0;
+    uint32_t i;
+    nvpair_t *nvp;
+    ep_packet_t *packet;
+    export_state_t *st = NULL;
+
+    if (conn == NULL || hdr == NULL || path == NULL || write_cb == NULL ||
+        format > MMX_EXPORT_FORMAT_BINARY)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    st = (export_state_t *)malloc(sizeof(export_state_t));
+    if (st == NULL)
+        GOTO_RET_WITH_ERROR(FA_NOT_ENOUGH_MEMORY, "Could not allocate export buffers");
+
+    st->out.write_cb = write_cb;
+    st->out.ctx = ctx;
+    st->out.err = 0;
+    st->out.len = 0;
+    st->prev_name[0] = '\0';
+
+    /* Send GetParamValue request for the whole subtree */
+    mmx_frontapi_msg_struct_init(&st->msg, st->pool, sizeof(st->pool));
+
+    st->msg.header = *hdr;
+    st->msg.header.respMode = MMX_API_RESPMODE_SYNC;
+    st->msg.header.msgType = MSGTYPE_GETVALUE;
+    st->msg.header.respCode = 0;
+    st->msg.header.moreFlag = 0;
+    st->msg.header.version = 0;
+    st->msg.header.delta = MMX_DELTA_FULL;
+    st->msg.header.fragment = 0;
+    st->msg.body.getParamValue.nextLevel = 0;
+    st->msg.body.getParamValue.configOnly = configOnly ? 1 : 0;
+    st->msg.body.getParamValue.arraySize = 1;
+    strcpy_safe(st->msg.body.getParamValue.paramNames[0], path, NVP_MAX_NAME_LEN);
+
+    packet = (ep_packet_t *)st->buf;
+    memset(packet->flags, 0, sizeof(packet->flags));
+    if (mmx_frontapi_message_build_ex(&st->msg, packet->msg,
+                                      sizeof(st->buf) - sizeof(packet->flags) - 1,
+                                      conn->path_dict) != FA_OK)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Could not build export request");
+
+    if (mmx_send_packet(conn, packet, &st->msg.header) != 0)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not send export request");
+
+    export_begin(st, format, path);
+
+    /* Write out every response fragment as soon as it is received */
+    while (more)
+    {
+        if (mmx_frontapi_receive_resp(conn, hdr->txaId, st->buf, sizeof(st->buf) - 1, &rcvd) != 0)
+            GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "No response from Entry point (txaId %d)",
+                                hdr->txaId);
+
+        mmx_frontapi_msg_struct_reset(&st->msg);
+
+        res = mmx_frontapi_message_parse_ex(st->buf, &st->msg, conn->path_dict);
+        if (st->msg.header.respCode != 0)
+            GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Entry point returned error %d",
+                                st->msg.header.respCode);
+        if (res != FA_OK || st->msg.header.msgType != MSGTYPE_GETVALUE_RESP)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Could not parse export response");
+
+        for (i = 0; i < st->msg.body.getParamValueResponse.arraySize; i++)
+        {
+            nvp = &st->msg.body.getParamValueResponse.paramValues[i];
+            export_pair(st, format, nvp->name, nvp->pValue ? nvp->pValue : "");
+            count++;
+        }
+
+        if (st->out.err)
+            GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not write export output");
+
+        more = st->msg.header.moreFlag;
+    }
+
+    export_end(st, format);
+    if (st->out.err)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not write export output");
+
+ret:
+    if (exported)
+        *exported = count;
+    free(st);
+    return status;
+}
+
+static int export_fd_write(void *ctx, const char *data, size_t len)
+{
+    int fd = *(int *)ctx;
+    ssize_t res;
+
+    while (len > 0)
+    {
+        res = write(fd, data, len);
+        if (res < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("Could not write export output");
+            return -1;
+        }
+        data += res;
+        len -= res;
+    }
+    return 0;
+}
+
+int mmx_frontapi_export_fd(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                           const char *path, int configOnly, mmx_export_format_t format,
+                           int fd, size_t *exported)
+{
+    return mmx_frontapi_export(conn, hdr, path, configOnly, format,
+                               export_fd_write, &fd, exported);
+}
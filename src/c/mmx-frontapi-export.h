@@ -0,0 +1,124 @@
+/* mmx-frontapi-export.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Streaming export of the data model.
+ * Parameter values are requested from the Entry-point with one GetParamValue
+ * request and every response fragment is written to the output as soon as it
+ * is received, so memory usage does not depend on the size of the exported tree.
+ */
+
+#ifndef MMX_FRONTAPI_EXPORT_H_
+#define MMX_FRONTAPI_EXPORT_H_
+
+#include "mmx-frontapi.h"
+
+/* Magic of the binary snapshot (followed by one byte of format version) */
+#define MMX_EXPORT_BIN_MAGIC     "MMXSNAP"
+#define MMX_EXPORT_BIN_VERSION   1
+
+typedef enum mmx_export_format_e {
+    MMX_EXPORT_FORMAT_XML = 0,   /* <paramValues> document of nameValuePair elements */
+    MMX_EXPORT_FORMAT_JSONL,     /* one {"name":...,"value":...} object per line */
+    MMX_EXPORT_FORMAT_BINARY     /* compact binary snapshot, see below */
+} mmx_export_format_t;
+
+/*
+ * Binary snapshot layout:
+ *   MMX_EXPORT_BIN_MAGIC (8 bytes incl. '\0'), version (1 byte),
+ *   records:  varint(shared) varint(suffix_len) suffix varint(value_len) value
+ *             where 'shared' is number of leading bytes of the name that are
+ *             equal to the name of the previous record,
+ *   end mark: varint(0) varint(0)
+ * Varints are unsigned LEB128.
+ */
+
+/*
+ * Output callback. Returns 0 on success; any other value aborts the export.
+ */
+typedef int (*mmx_export_write_cb_t)(void *ctx, const char *data, size_t len);
+
+/*
+ * Exports values of all parameters of the subtree 'path' (e.g. "Device.")
+ * in the specified format via 'write_cb'.
+ * Header fields of the request are taken from 'hdr'.
+ * If 'configOnly' is set only writable parameters are exported.
+ * Number of exported parameters is returned in 'exported' (may be NULL).
+ */
+int mmx_frontapi_export(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                        const char *path, int configOnly, mmx_export_format_t format,
+                        mmx_export_write_cb_t write_cb, void *ctx, size_t *exported);
+
+/*
+ * The same as mmx_frontapi_export, but writes the output to file descriptor 'fd'
+ */
+int mmx_frontapi_export_fd(mmx_ep_connection_t *conn, const ep_msg_header_t *hdr,
+                           const char *path, int configOnly, mmx_export_format_t format,
+                           int fd, size_t *exported);
+
+#endif /* MMX_FRONTAPI_EXPORT_H_ */
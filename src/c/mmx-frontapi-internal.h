@@ -0,0 +1,195 @@
+/* mmx-frontapi-internal.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Definitions shared between the translation units of libmmx-frontapi.
+ * This header is not installed and must not be included by applications.
+ */
+
+#ifndef MMX_FRONTAPI_INTERNAL_H_
+#define MMX_FRONTAPI_INTERNAL_H_
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-stats.h"
+#include "mmx-frontapi-trace.h"
+#include "mmx-frontapi-capture.h"
+
+/* Size of the buffer used for a single Entry-point datagram */
+#define FA_BUF_SIZE     2048
+
+#define GOTO_RET_WITH_ERROR(err_num, msg, ...)     do { \
+    ing_log(LOG_ERR, msg"\n", ##__VA_ARGS__); \
+    status = err_num; \
+    goto ret; \
+} while (0)
+
+/*
+ * FNV-1a hash of the string, at most 'len' characters (SIZE_MAX - the
+ * whole string)
+ */
+static inline uint32_t mmx_hash(const char *str, size_t len)
+{
+    uint32_t h = 2166136261u;
+
+    while (len-- && *str)
+    {
+        h ^= (unsigned char)*str++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/*
+ * Statistics hooks (mmx-frontapi-stats.c). The inline wrappers do nothing
+ * if the connection has no statistics block.
+ */
+uint64_t mmx_stats_now_us(void);
+uint64_t mmx_stats_record(mmx_ep_stats_t *stats, mmx_stats_phase_t phase, uint64_t since);
+void mmx_stats_finish(mmx_ep_stats_t *stats, msgtype_t type, int status, uint64_t start);
+void mmx_stats_count(uint64_t *counter, uint64_t val);
+
+/* Returns start time of a request */
+static inline uint64_t mmx_stats_start(mmx_ep_stats_t *stats)
+{
+    return stats ? mmx_stats_now_us() : 0;
+}
+
+/* Records duration of the phase started at 'since'; returns current time */
+static inline uint64_t mmx_stats_lap(mmx_ep_stats_t *stats, mmx_stats_phase_t phase, uint64_t since)
+{
+    return stats ? mmx_stats_record(stats, phase, since) : 0;
+}
+
+/* Counts finished request and records its total duration */
+static inline void mmx_stats_done(mmx_ep_stats_t *stats, msgtype_t type, int status, uint64_t start)
+{
+    if (stats)
+        mmx_stats_finish(stats, type, status, start);
+}
+
+#define MMX_STATS_COUNT(stats, field, val)  do { \
+    if (stats) \
+        mmx_stats_count(&(stats)->field, (val)); \
+} while (0)
+
+/*
+ * Trace points (mmx-frontapi-trace.c). Probe of USDT build is a nop
+ * instruction; the callback is called only if it is set.
+ */
+#ifdef MMX_FRONTAPI_USDT
+#include <sys/sdt.h>
+#define MMX_TRACE_PROBE(name, txaId, msgType, callerId, size, status) \
+    DTRACE_PROBE5(mmx_frontapi, name, txaId, msgType, callerId, size, status)
+#else
+#define MMX_TRACE_PROBE(name, txaId, msgType, callerId, size, status)  do { } while (0)
+#endif
+
+extern mmx_trace_cb_t mmx_trace_cb;
+void mmx_trace_emit(mmx_trace_point_t point, int txaId, int msgType, int callerId,
+                    size_t size, int status);
+
+#define MMX_TRACE(name, point, txaId, msgType, callerId, size, status)  do { \
+    MMX_TRACE_PROBE(name, (txaId), (msgType), (callerId), (size), (status)); \
+    if (mmx_trace_cb) \
+        mmx_trace_emit((point), (txaId), (msgType), (callerId), (size), (status)); \
+} while (0)
+
+/* The same for the message header 'hdr' */
+#define MMX_TRACE_HDR(name, point, hdr, size, status) \
+    MMX_TRACE(name, point, (hdr)->txaId, (int)(hdr)->msgType, (hdr)->callerId, size, status)
+
+/* Writes the packet to the capture of the connection (if any) */
+#define MMX_CAPTURE(conn, dir, txaId, data, len)  do { \
+    if ((conn)->capture) \
+        mmx_capture_write((conn)->capture, (dir), (conn)->sock, (txaId), (data), (len)); \
+} while (0)
+
+/*
+ * Sends the packet of the message with header 'hdr' (used for tracing,
+ * may be NULL)
+ */
+int mmx_send_packet(mmx_ep_connection_t *conn, ep_packet_t *pkt, const ep_msg_header_t *hdr);
+
+/*
+ * Hands Notify message received on the connection to its notification
+ * context (mmx-frontapi-notify.c)
+ */
+void mmx_notify_input(mmx_ep_connection_t *conn, const char *xml);
+
+/*
+ * Path dictionary of a parsed message (mmx-frontapi-pathdict.c), the same
+ * for the XML and the lazy parsers. mmx_path_dict_follow handles generation
+ * from the header: client resets the dictionary, Entry-point forgets the
+ * Ids used by the client. mmx_path_dict_decode returns prefix with the Id
+ * (NULL if unknown) and Entry-point marks it as received by the client.
+ */
+void mmx_path_dict_follow(mmx_path_dict_t *dict, uint32_t generation);
+const char *mmx_path_dict_decode(mmx_path_dict_t *dict, uint32_t generation,
+                                 const char *id_str, size_t *len);
+
+#endif /* MMX_FRONTAPI_INTERNAL_H_ */
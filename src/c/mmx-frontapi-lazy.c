@@ -0,0 +1,362 @@
+/* mmx-frontapi-lazy.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Lazy parsing of Entry-point messages: the header is parsed, the body
+ * is decoded on demand by scanning its text
+ */
+#include <string.h>
+#include <stdlib.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-pathdict.h"
+#include "mmx-frontapi-lazy.h"
+
+#define LAZY_ROOT_OPEN    "<" MSG_STR_ROOT_NAME ">"
+#define LAZY_ROOT_CLOSE   "</" MSG_STR_ROOT_NAME ">"
+#define LAZY_HDR_OPEN     "<" MSG_STR_HEADER ">"
+#define LAZY_HDR_CLOSE    "</" MSG_STR_HEADER ">"
+#define LAZY_BODY_OPEN    "<" MSG_STR_BODY
+#define LAZY_BODY_CLOSE   "</" MSG_STR_BODY ">"
+
+/* Element found in the text */
+typedef struct lazy_elem_s {
+    const char *attrs;      /* Attributes of the start tag */
+    size_t attrs_len;
+    const char *text;       /* Content (empty for <tag/>) */
+    size_t text_len;
+    const char *after;      /* First character after the element */
+} lazy_elem_t;
+
+/* Finds element <tag> in [from, end); its content must not contain the same element */
+static int lazy_find(const char *from, const char *end, const char *tag, lazy_elem_t *el)
+{
+    size_t tag_len = strlen(tag);
+    const char *p = from, *gt, *close;
+
+    while (p < end && (p = memchr(p, '<', end - p)) != NULL)
+    {
+        p++;
+        if ((size_t)(end - p) <= tag_len || strncmp(p, tag, tag_len) != 0 ||
+            !(p[tag_len] == '>' || p[tag_len] == '/' || p[tag_len] == ' ' ||
+              p[tag_len] == '\t' || p[tag_len] == '\r' || p[tag_len] == '\n'))
+            continue;
+
+        if ((gt = memchr(p + tag_len, '>', end - p - tag_len)) == NULL)
+            return FA_INVALID_FORMAT;
+
+        el->attrs = p + tag_len;
+        if (gt[-1] == '/')
+        {
+            el->attrs_len = gt - 1 - el->attrs;
+            el->text = gt;
+            el->text_len = 0;
+            el->after = gt + 1;
+            return FA_OK;
+        }
+        el->attrs_len = gt - el->attrs;
+        el->text = gt + 1;
+
+        /* Closing tag </tag> */
+        for (close = el->text; close < end; close++)
+        {
+            if ((close = memchr(close, '<', end - close)) == NULL)
+                break;
+            if ((size_t)(end - close) >= tag_len + 3 && close[1] == '/' &&
+                !strncmp(close + 2, tag, tag_len) && close[tag_len + 2] == '>')
+            {
+                el->text_len = close - el->text;
+                el->after = close + tag_len + 3;
+                return FA_OK;
+            }
+        }
+        return FA_INVALID_FORMAT;
+    }
+    return FA_GENERAL_ERROR;   /* not found */
+}
+
+/* Copies value of the attribute to 'buf'; returns FA_OK if it is present */
+static int lazy_attr(const lazy_elem_t *el, const char *name, char *buf, size_t size)
+{
+    size_t name_len = strlen(name), len;
+    const char *p = el->attrs, *end = el->attrs + el->attrs_len, *q;
+
+    for (; p + name_len + 2 < end; p++)
+    {
+        if ((p == el->attrs || p[-1] == ' ') && !strncmp(p, name, name_len) &&
+            p[name_len] == '=' && (p[name_len + 1] == '"' || p[name_len + 1] == '\''))
+        {
+            p += name_len + 2;
+            if ((q = memchr(p, p[-1], end - p)) == NULL)
+                return FA_INVALID_FORMAT;
+            len = q - p < (ptrdiff_t)size ? (size_t)(q - p) : size - 1;
+            memcpy(buf, p, len);
+            buf[len] = '\0';
+            return FA_OK;
+        }
+    }
+    return FA_GENERAL_ERROR;
+}
+
+/*
+ * Copies XML text to 'to' replacing the entity references. Returns
+ * FA_NOT_ENOUGH_MEMORY if the text is truncated.
+ */
+static int lazy_text(const char *text, size_t len, char *to, size_t size)
+{
+    static const struct { const char *ent; size_t len; char c; } ents[] = {
+        {"&lt;", 4, '<'}, {"&gt;", 4, '>'}, {"&amp;", 5, '&'}, {"&quot;", 6, '"'}, {"&apos;", 6, '\''}
+    };
+    const char *end = text + len, *semi;
+    size_t n = 0, i;
+    long code;
+
+    while (text < end)
+    {
+        if (n + 1 >= size)
+        {
+            to[n] = '\0';
+            return FA_NOT_ENOUGH_MEMORY;
+        }
+
+        if (*text != '&')
+        {
+            to[n++] = *text++;
+            continue;
+        }
+
+        for (i = 0; i < sizeof(ents) / sizeof(ents[0]); i++)
+            if ((size_t)(end - text) >= ents[i].len && !strncmp(text, ents[i].ent, ents[i].len))
+                break;
+        if (i < sizeof(ents) / sizeof(ents[0]))
+        {
+            to[n++] = ents[i].c;
+            text += ents[i].len;
+        }
+        else if (text + 2 < end && text[1] == '#' &&
+                 (semi = memchr(text, ';', end - text)) != NULL &&
+                 (code = (text[2] == 'x' ? strtol(text + 3, NULL, 16) : strtol(text + 2, NULL, 10))) > 0 &&
+                 code < 256)
+        {
+            to[n++] = (char)code;
+            text = semi + 1;
+        }
+        else
+            to[n++] = *text++;
+    }
+
+    to[n] = '\0';
+    return FA_OK;
+}
+
+int mmx_frontapi_message_parse_lazy(const char *xmlmsg, mmx_lazy_msg_t *msg,
+                                    mmx_path_dict_t *dict)
+{
+    int status = FA_OK;
+    char buf[FA_BUF_SIZE];
+    const char *hdr, *hdr_end, *body, *body_end;
+    size_t len;
+
+    if (xmlmsg == NULL || msg == NULL)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    memset(msg, 0, sizeof(*msg));
+    msg->xml = xmlmsg;
+    msg->dict = dict;
+
+    if (strstr(xmlmsg, "<" MSG_STR_ROOT_NAME) == NULL ||
+        (hdr = strstr(xmlmsg, LAZY_HDR_OPEN)) == NULL ||
+        (hdr_end = strstr(hdr, LAZY_HDR_CLOSE)) == NULL)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect format of the message");
+    hdr_end += strlen(LAZY_HDR_CLOSE);
+
+    /* Only the header is given to the XML parser */
+    len = hdr_end - hdr;
+    if (len + sizeof(LAZY_ROOT_OPEN) + sizeof(LAZY_ROOT_CLOSE) > sizeof(buf))
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Message header is too long");
+    memcpy(buf, LAZY_ROOT_OPEN, sizeof(LAZY_ROOT_OPEN) - 1);
+    memcpy(buf + sizeof(LAZY_ROOT_OPEN) - 1, hdr, len);
+    strcpy(buf + sizeof(LAZY_ROOT_OPEN) - 1 + len, LAZY_ROOT_CLOSE);
+
+    if ((status = mmx_frontapi_msg_header_parse(buf, &msg->header)) != FA_OK)
+        goto ret;
+
+    mmx_path_dict_follow(dict, msg->header.pathDict);
+
+    /* Body span: <body/> or <body>...</body> */
+    if ((body = strstr(hdr_end, LAZY_BODY_OPEN)) == NULL)
+        goto ret;
+    body += strlen(LAZY_BODY_OPEN);
+    if (body[0] == '/' && body[1] == '>')
+    {
+        msg->body = body + 2;
+        goto ret;
+    }
+    if (body[0] != '>' || (body_end = strstr(body + 1, LAZY_BODY_CLOSE)) == NULL)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect format of the message body");
+
+    msg->body = body + 1;
+    msg->body_len = body_end - msg->body;
+
+ret:
+    return status;
+}
+
+unsigned mmx_lazy_nvpair_count(const mmx_lazy_msg_t *msg)
+{
+    lazy_elem_t el;
+    char buf[16];
+
+    if (msg->body == NULL ||
+        lazy_find(msg->body, msg->body + msg->body_len, MSG_STR_PARAMVALUES, &el) != FA_OK ||
+        lazy_attr(&el, MSG_STR_ATTR_ARRAYSIZE, buf, sizeof(buf)) != FA_OK)
+        return 0;
+
+    return (unsigned)strtoul(buf, NULL, 10);
+}
+
+void mmx_lazy_nvpair_iter_init(const mmx_lazy_msg_t *msg, mmx_lazy_iter_t *it,
+                               char *value, size_t value_size)
+{
+    it->msg = msg;
+    it->pos = msg->body;
+    it->index = 0;
+    it->status = (value != NULL && value_size > 0) ? FA_OK : FA_BAD_INPUT_PARAMS;
+    it->value = value;
+    it->value_size = value_size;
+}
+
+const nvpair_t *mmx_lazy_nvpair_next(mmx_lazy_iter_t *it)
+{
+    const mmx_lazy_msg_t *msg = it->msg;
+    const char *end, *prefix;
+    lazy_elem_t pair, el;
+    char id_str[16];
+    size_t len = 0;
+    int res;
+
+    if (it->status != FA_OK || it->pos == NULL)
+        return NULL;
+    end = msg->body + msg->body_len;
+
+    res = lazy_find(it->pos, end, MSG_STR_NAMEVALUEPAIR, &pair);
+    if (res != FA_OK)
+    {
+        /* No more pairs */
+        it->status = (res == FA_GENERAL_ERROR) ? FA_OK : res;
+        it->pos = NULL;
+        return NULL;
+    }
+    it->pos = pair.after;
+
+    if ((res = lazy_find(pair.text, pair.text + pair.text_len, MSG_STR_NAME, &el)) != FA_OK)
+    {
+        it->status = FA_INVALID_FORMAT;
+        ing_log(LOG_ERR, "Incorrect syntax: pair name missing\n");
+        return NULL;
+    }
+
+    /* Name encoded with the path dictionary: prefix Id + suffix */
+    if (lazy_attr(&el, MSG_STR_ATTR_PATHDICT, id_str, sizeof(id_str)) == FA_OK)
+    {
+        prefix = mmx_path_dict_decode(msg->dict, msg->header.pathDict, id_str, &len);
+        if (prefix == NULL)
+        {
+            it->status = FA_INVALID_FORMAT;
+            return NULL;
+        }
+        if (len >= sizeof(it->pair.name))
+            len = sizeof(it->pair.name) - 1;
+        memcpy(it->pair.name, prefix, len);
+    }
+    lazy_text(el.text, el.text_len, it->pair.name + len, sizeof(it->pair.name) - len);
+
+    if ((res = lazy_find(pair.text, pair.text + pair.text_len, MSG_STR_VALUE, &el)) != FA_OK)
+    {
+        it->status = FA_INVALID_FORMAT;
+        ing_log(LOG_ERR, "Incorrect syntax: pair value missing\n");
+        return NULL;
+    }
+    if (lazy_text(el.text, el.text_len, it->value, it->value_size) != FA_OK)
+    {
+        it->status = FA_NOT_ENOUGH_MEMORY;
+        ing_log(LOG_ERR, "Value of param %s does not fit in %zu bytes\n",
+                it->pair.name, it->value_size);
+        return NULL;
+    }
+
+    it->pair.pValue = it->value;
+    it->index++;
+    return &it->pair;
+}
+
+int mmx_lazy_decode(const mmx_lazy_msg_t *msg, ep_message_t *message)
+{
+    return mmx_frontapi_message_parse_ex(msg->xml, message, msg->dict);
+}
@@ -0,0 +1,139 @@
+/* mmx-frontapi-lazy.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Lazy parsing of Entry-point messages.
+ *
+ * mmx_frontapi_message_parse_lazy parses only the header of the message
+ * and records where its body is. Nothing of the body is decoded until it
+ * is accessed: name-value pairs (GetParamValue response, SetParamValue
+ * and AddObject requests) are decoded one by one by the iterator, the
+ * whole body may still be decoded with mmx_lazy_decode. Routers, proxies
+ * and filters which look at the header only skip the body work entirely.
+ *
+ * The lazy message refers to the XML string, which must not be changed
+ * or freed while the message is in use.
+ */
+
+#ifndef MMX_FRONTAPI_LAZY_H_
+#define MMX_FRONTAPI_LAZY_H_
+
+#include "mmx-frontapi.h"
+
+typedef struct mmx_lazy_msg_s {
+    ep_msg_header_t header;
+    const char *xml;            /* The whole message */
+    const char *body;           /* Content of the body element (NULL - no body) */
+    size_t body_len;
+    mmx_path_dict_t *dict;      /* Dictionary of the encoded names (may be NULL) */
+} mmx_lazy_msg_t;
+
+/* Iterator over name-value pairs of the body */
+typedef struct mmx_lazy_iter_s {
+    const mmx_lazy_msg_t *msg;
+    const char *pos;            /* Where to look for the next pair */
+    unsigned index;             /* Number of decoded pairs */
+    int status;                 /* FA_OK or error that stopped the iteration */
+    nvpair_t pair;
+    char *value;                /* Buffer supplied by the caller for the value */
+    size_t value_size;
+} mmx_lazy_iter_t;
+
+/*
+ * Parses the header of the message and finds its body. The path
+ * dictionary (may be NULL) is used as by mmx_frontapi_message_parse_ex.
+ */
+int mmx_frontapi_message_parse_lazy(const char *xmlmsg, mmx_lazy_msg_t *msg,
+                                    mmx_path_dict_t *dict);
+
+/*
+ * Returns number of name-value pairs given by the arraySize attribute of
+ * the body (0 if there are none)
+ */
+unsigned mmx_lazy_nvpair_count(const mmx_lazy_msg_t *msg);
+
+/*
+ * Starts iteration over name-value pairs. Values are decoded to 'value'
+ * buffer, so a pair returned by mmx_lazy_nvpair_next is valid till the
+ * next call.
+ */
+void mmx_lazy_nvpair_iter_init(const mmx_lazy_msg_t *msg, mmx_lazy_iter_t *it,
+                               char *value, size_t value_size);
+
+/*
+ * Decodes the next name-value pair. Returns NULL if there are no more
+ * pairs or on error (it->status is not FA_OK then).
+ */
+const nvpair_t *mmx_lazy_nvpair_next(mmx_lazy_iter_t *it);
+
+/*
+ * Decodes the whole message (see mmx_frontapi_message_parse_ex)
+ */
+int mmx_lazy_decode(const mmx_lazy_msg_t *msg, ep_message_t *message);
+
+#endif /* MMX_FRONTAPI_LAZY_H_ */
@@ -0,0 +1,266 @@
+/* mmx-frontapi-msgpool.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Per-thread pool of message structures
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-msgpool.h"
+
+typedef struct msgpool_s {
+    unsigned objects;
+    unsigned short value_size;
+    unsigned free_count;
+    ep_message_t *msgs;
+    char *values;             /* Value pools of all messages */
+    unsigned *free_list;      /* Stack of indexes of free messages */
+    unsigned char *busy;
+    mmx_msgpool_stats_t stats;
+} msgpool_t;
+
+static __thread msgpool_t *thread_pool = NULL;
+
+int mmx_msgpool_thread_init(unsigned objects, unsigned short value_pool_size)
+{
+    int status = FA_OK;
+    msgpool_t *mp = NULL;
+    unsigned i;
+
+    if (thread_pool != NULL)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Message pool of the thread already exists");
+
+    if (objects == 0 || objects > MMX_MSGPOOL_MAX_OBJECTS || value_pool_size <= 16)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    if ((mp = calloc(1, sizeof(*mp))) == NULL ||
+        (mp->msgs = malloc(objects * sizeof(ep_message_t))) == NULL ||
+        (mp->values = malloc((size_t)objects * value_pool_size)) == NULL ||
+        (mp->free_list = malloc(objects * sizeof(unsigned))) == NULL ||
+        (mp->busy = calloc(objects, 1)) == NULL)
+        GOTO_RET_WITH_ERROR(FA_NOT_ENOUGH_MEMORY, "Could not allocate message pool");
+
+    /* The only full initialization of the value pools */
+    for (i = 0; i < objects; i++)
+    {
+        mmx_frontapi_msg_struct_init(&mp->msgs[i], mp->values + (size_t)i * value_pool_size,
+                                     value_pool_size);
+        mp->free_list[i] = objects - 1 - i;
+#ifdef MMX_MSGPOOL_DEBUG
+        memset(&mp->msgs[i].header, MMX_MSGPOOL_POISON, sizeof(mp->msgs[i].header));
+#endif
+    }
+
+    mp->objects = objects;
+    mp->value_size = value_pool_size;
+    mp->free_count = objects;
+    mp->stats.objects = objects;
+    mp->stats.value_pool_size = value_pool_size;
+    thread_pool = mp;
+
+ret:
+    if (status != FA_OK && mp != NULL && thread_pool != mp)
+    {
+        free(mp->msgs);
+        free(mp->values);
+        free(mp->free_list);
+        free(mp->busy);
+        free(mp);
+    }
+    return status;
+}
+
+void mmx_msgpool_thread_destroy(void)
+{
+    msgpool_t *mp = thread_pool;
+
+    if (mp == NULL)
+        return;
+
+    if (mp->free_count != mp->objects)
+        ing_log(LOG_ERR, "Message pool is destroyed with %u messages in use\n",
+                mp->objects - mp->free_count);
+
+    free(mp->msgs);
+    free(mp->values);
+    free(mp->free_list);
+    free(mp->busy);
+    free(mp);
+    thread_pool = NULL;
+}
+
+#ifdef MMX_MSGPOOL_DEBUG
+/* Reports writes to the returned message (its poisoned part was modified) */
+static void msgpool_check_poison(const ep_message_t *message)
+{
+    const unsigned char *p = (const unsigned char *)&message->header;
+    size_t i;
+
+    for (i = 0; i < sizeof(message->header); i++)
+        if (p[i] != MMX_MSGPOOL_POISON)
+            break;
+    if (i == sizeof(message->header))
+    {
+        p = (const unsigned char *)message->mem_pool.pool;
+        for (i = 0; i < message->mem_pool.curr_offset; i++)
+            if (p[i] != MMX_MSGPOOL_POISON)
+                break;
+        if (i == message->mem_pool.curr_offset)
+            return;
+    }
+    ing_log(LOG_ERR, "Message %p was modified after it was returned to the pool\n", message);
+}
+#endif
+
+ep_message_t *mmx_msgpool_get(void)
+{
+    msgpool_t *mp = thread_pool;
+    ep_message_t *message;
+    unsigned idx, in_use;
+
+    if (mp == NULL)
+        return NULL;
+
+    if (mp->free_count == 0)
+    {
+        mp->stats.exhausted++;
+        return NULL;
+    }
+
+    idx = mp->free_list[--mp->free_count];
+    mp->busy[idx] = 1;
+    message = &mp->msgs[idx];
+
+#ifdef MMX_MSGPOOL_DEBUG
+    msgpool_check_poison(message);
+#endif
+
+    /* Lazy reset: bytes after curr_offset are still zero */
+    mmx_frontapi_msg_struct_reset(message);
+
+    in_use = mp->objects - mp->free_count;
+    mp->stats.gets++;
+    mp->stats.in_use = in_use;
+    if (in_use > mp->stats.max_in_use)
+        mp->stats.max_in_use = in_use;
+
+    return message;
+}
+
+int mmx_msgpool_put(ep_message_t *message)
+{
+    int status = FA_OK;
+    msgpool_t *mp = thread_pool;
+    unsigned idx, used;
+
+    if (mp == NULL || message < mp->msgs || message >= mp->msgs + mp->objects)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Message %p is not from the pool of the thread",
+                            message);
+
+    idx = (unsigned)(message - mp->msgs);
+    if (!mp->busy[idx])
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Message %p is returned to the pool twice",
+                            message);
+
+    /* A caller could replace the value pool: restore it */
+    if (!message->mem_pool.initialized ||
+        message->mem_pool.pool != mp->values + (size_t)idx * mp->value_size ||
+        message->mem_pool.size_bytes != mp->value_size ||
+        message->mem_pool.curr_offset > mp->value_size)
+        mmx_frontapi_msg_struct_init(message, mp->values + (size_t)idx * mp->value_size,
+                                     mp->value_size);
+
+    used = message->mem_pool.curr_offset;
+    if (used > mp->stats.max_value_bytes)
+        mp->stats.max_value_bytes = used;
+    mp->stats.value_hist[(size_t)used * MMX_MSGPOOL_HIST_BUCKETS / (mp->value_size + 1)]++;
+
+#ifdef MMX_MSGPOOL_DEBUG
+    memset(&message->header, MMX_MSGPOOL_POISON, sizeof(message->header));
+    memset(message->mem_pool.pool, MMX_MSGPOOL_POISON, used);
+#endif
+
+    mp->busy[idx] = 0;
+    mp->free_list[mp->free_count++] = idx;
+    mp->stats.in_use = mp->objects - mp->free_count;
+
+ret:
+    return status;
+}
+
+int mmx_msgpool_stats(mmx_msgpool_stats_t *stats)
+{
+    if (stats == NULL || thread_pool == NULL)
+        return FA_BAD_INPUT_PARAMS;
+
+    *stats = thread_pool->stats;
+    return FA_OK;
+}
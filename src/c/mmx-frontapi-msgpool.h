@@ -0,0 +1,142 @@
+/* mmx-frontapi-msgpool.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Per-thread pool of message structures.
+ *
+ * Every thread that handles messages in a loop (e.g. a worker of the
+ * Entry-point) creates its own pool of ep_message_t structures with
+ * attached value pools once, and then takes a message with mmx_msgpool_get
+ * and returns it with mmx_msgpool_put, both O(1). Instead of zeroing the
+ * whole value pool as mmx_frontapi_msg_struct_init does, a message taken
+ * from the pool has its header and only the used part of its value pool
+ * (curr_offset bytes) cleared. The body is not cleared, the caller sets
+ * it as after mmx_frontapi_msg_struct_init.
+ *
+ * The pool keeps high-water marks of the objects in use and of the used
+ * part of the value pools (see mmx_msgpool_stats_t) to help choosing the
+ * size of the value pools.
+ *
+ * If the library is built with MSGPOOL_DEBUG=1 the returned messages are
+ * poisoned: their header and used part of the value pool are filled with
+ * MMX_MSGPOOL_POISON, and writes to a returned message are reported when
+ * it is taken again.
+ */
+
+#ifndef MMX_FRONTAPI_MSGPOOL_H_
+#define MMX_FRONTAPI_MSGPOOL_H_
+
+#include "mmx-frontapi.h"
+
+#define MMX_MSGPOOL_MAX_OBJECTS     256
+#define MMX_MSGPOOL_POISON          0xA5
+
+/* Returned messages are counted by the used part of their value pool, in eighths */
+#define MMX_MSGPOOL_HIST_BUCKETS    8
+
+typedef struct mmx_msgpool_stats_s {
+    unsigned objects;           /* Messages in the pool */
+    unsigned value_pool_size;   /* Size of the value pool of every message */
+    unsigned in_use;
+    unsigned max_in_use;        /* High-water mark of the messages in use */
+    unsigned max_value_bytes;   /* High-water mark of the used part of a value pool */
+    unsigned long gets;
+    unsigned long exhausted;    /* mmx_msgpool_get calls failed as no message was free */
+    unsigned long value_hist[MMX_MSGPOOL_HIST_BUCKETS];
+} mmx_msgpool_stats_t;
+
+/*
+ * Creates the pool of the calling thread: 'objects' messages with value
+ * pools of 'value_pool_size' bytes each. The pool must be destroyed by the
+ * same thread before it exits.
+ */
+int mmx_msgpool_thread_init(unsigned objects, unsigned short value_pool_size);
+
+/*
+ * Frees the pool of the calling thread
+ */
+void mmx_msgpool_thread_destroy(void);
+
+/*
+ * Takes a message from the pool of the calling thread. The message is
+ * initialized (as by mmx_frontapi_msg_struct_init) and its header is
+ * cleared. Returns NULL if there is no pool or all messages are in use.
+ */
+ep_message_t *mmx_msgpool_get(void);
+
+/*
+ * Returns the message taken by mmx_msgpool_get to the pool
+ */
+int mmx_msgpool_put(ep_message_t *message);
+
+/*
+ * Copies statistics of the pool of the calling thread
+ */
+int mmx_msgpool_stats(mmx_msgpool_stats_t *stats);
+
+#endif /* MMX_FRONTAPI_MSGPOOL_H_ */
@@ -0,0 +1,373 @@
+/* mmx-frontapi-nametree.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Name tree - radix tree of parameter names in caller supplied memory
+ */
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-nametree.h"
+
+/*
+ * Node of the tree. Label of the node follows the structure.
+ * Links are offsets in the memory buffer; the root node is always placed
+ * at offset 0, so 0 means "no node" for child and sibling links.
+ * Siblings are ordered by the first character of their labels.
+ */
+typedef struct nt_node_s {
+    uint32_t child;
+    uint32_t sibling;
+    uint32_t value;
+    uint16_t label_len;
+    uint8_t  has_value;
+    uint8_t  reserved;
+} nt_node_t;
+
+#define NT_ALIGN(x)      (((x) + 3) & ~3u)
+#define NT_NODE(t, off)  ((nt_node_t *)((t)->mem + (off)))
+#define NT_LABEL(node)   ((char *)(node) + sizeof(nt_node_t))
+
+static uint32_t nt_node_new(mmx_name_tree_t *tree, const char *label, size_t len)
+{
+    uint32_t off = tree->used;
+    uint32_t need = NT_ALIGN(sizeof(nt_node_t) + len);
+    nt_node_t *node;
+
+    if (tree->size - tree->used < need)
+        return 0;
+
+    node = NT_NODE(tree, off);
+    memset(node, 0, sizeof(*node));
+    node->label_len = len;
+    memcpy(NT_LABEL(node), label, len);
+
+    tree->used += need;
+    return off;
+}
+
+/* Finds child starting with 'c'; 'prev' receives preceding sibling (or 0) */
+static uint32_t nt_find_child(const mmx_name_tree_t *tree, const nt_node_t *parent,
+                              unsigned char c, uint32_t *prev)
+{
+    uint32_t off = parent->child;
+    const nt_node_t *node;
+
+    if (prev)
+        *prev = 0;
+
+    while (off != 0)
+    {
+        node = NT_NODE(tree, off);
+        if ((unsigned char)NT_LABEL(node)[0] >= c)
+            return ((unsigned char)NT_LABEL(node)[0] == c) ? off : 0;
+        if (prev)
+            *prev = off;
+        off = node->sibling;
+    }
+    return 0;
+}
+
+int mmx_name_tree_init(mmx_name_tree_t *tree, char *mem_buff, uint32_t mem_buff_size)
+{
+    int status = FA_OK;
+
+    if (tree == NULL || mem_buff == NULL || mem_buff_size < sizeof(nt_node_t))
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    /* Offset-based nodes must be aligned in the buffer */
+    if ((uintptr_t)mem_buff & 3)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Memory buffer is not aligned");
+
+    tree->mem = mem_buff;
+    tree->size = mem_buff_size;
+    tree->used = 0;
+    tree->count = 0;
+    nt_node_new(tree, "", 0);   /* root */
+
+ret:
+    return status;
+}
+
+int mmx_name_tree_insert(mmx_name_tree_t *tree, const char *name, uint32_t value)
+{
+    uint32_t off = 0, child, prev, split;
+    nt_node_t *node, *cnode, *snode;
+    size_t len, k;
+
+    if (tree == NULL || name == NULL || strlen(name) >= NVP_MAX_NAME_LEN)
+        return FA_BAD_INPUT_PARAMS;
+
+    while (*name)
+    {
+        node = NT_NODE(tree, off);
+        child = nt_find_child(tree, node, *name, &prev);
+
+        if (child == 0)
+        {
+            /* New leaf with the rest of the name */
+            len = strlen(name);
+            if ((child = nt_node_new(tree, name, len)) == 0)
+                return FA_NOT_ENOUGH_MEMORY;
+
+            node = NT_NODE(tree, off);
+            cnode = NT_NODE(tree, child);
+            if (prev == 0)
+            {
+                cnode->sibling = node->child;
+                node->child = child;
+            }
+            else
+            {
+                cnode->sibling = NT_NODE(tree, prev)->sibling;
+                NT_NODE(tree, prev)->sibling = child;
+            }
+            off = child;
+            break;
+        }
+
+        cnode = NT_NODE(tree, child);
+        for (k = 1; k < cnode->label_len && name[k] == NT_LABEL(cnode)[k]; k++)
+            ;
+
+        if (k < cnode->label_len)
+        {
+            /* Split the label: the tail moves to the new child node */
+            if ((split = nt_node_new(tree, NT_LABEL(cnode) + k, cnode->label_len - k)) == 0)
+                return FA_NOT_ENOUGH_MEMORY;
+
+            cnode = NT_NODE(tree, child);
+            snode = NT_NODE(tree, split);
+            snode->child = cnode->child;
+            snode->value = cnode->value;
+            snode->has_value = cnode->has_value;
+
+            cnode->child = split;
+            cnode->label_len = k;
+            cnode->has_value = 0;
+            cnode->value = 0;
+        }
+
+        off = child;
+        name += k;
+    }
+
+    node = NT_NODE(tree, off);
+    if (!node->has_value)
+        tree->count++;
+    node->has_value = 1;
+    node->value = value;
+
+    return FA_OK;
+}
+
+/*
+ * Descends by 'name'. Returns the node whose path starts with 'name'
+ * (matched - length of the node path part that is in 'name') or -1.
+ */
+static long nt_descend(const mmx_name_tree_t *tree, const char *name, size_t *matched)
+{
+    uint32_t off = 0;
+    const nt_node_t *node;
+    size_t len = strlen(name), k;
+
+    *matched = 0;
+    while (len > 0)
+    {
+        off = nt_find_child(tree, NT_NODE(tree, off), *name, NULL);
+        if (off == 0)
+            return -1;
+
+        node = NT_NODE(tree, off);
+        k = (node->label_len < len) ? node->label_len : len;
+        if (memcmp(NT_LABEL(node), name, k))
+            return -1;
+
+        *matched = k;
+        name += k;
+        len -= k;
+    }
+    return off;
+}
+
+int mmx_name_tree_find(const mmx_name_tree_t *tree, const char *name, uint32_t *value)
+{
+    long off;
+    size_t matched;
+    const nt_node_t *node;
+
+    if (tree == NULL || name == NULL)
+        return FA_BAD_INPUT_PARAMS;
+
+    if ((off = nt_descend(tree, name, &matched)) < 0)
+        return FA_GENERAL_ERROR;
+
+    node = NT_NODE(tree, off);
+    if (!node->has_value || (off != 0 && matched != node->label_len))
+        return FA_GENERAL_ERROR;
+
+    if (value)
+        *value = node->value;
+    return FA_OK;
+}
+
+/* Depth-first walk; 'buf' keeps path of the node of length 'len' */
+static int nt_walk(const mmx_name_tree_t *tree, uint32_t off, char *buf, size_t len,
+                   mmx_name_tree_cb_t cb, void *ctx)
+{
+    const nt_node_t *node = NT_NODE(tree, off);
+    int res;
+
+    if (node->has_value)
+    {
+        buf[len] = '\0';
+        if ((res = cb(buf, node->value, ctx)) != 0)
+            return res;
+    }
+
+    for (off = node->child; off != 0; off = node->sibling)
+    {
+        node = NT_NODE(tree, off);
+        memcpy(buf + len, NT_LABEL(node), node->label_len);
+        if ((res = nt_walk(tree, off, buf, len + node->label_len, cb, ctx)) != 0)
+            return res;
+    }
+    return 0;
+}
+
+int mmx_name_tree_foreach(const mmx_name_tree_t *tree, const char *prefix,
+                          mmx_name_tree_cb_t cb, void *ctx)
+{
+    char buf[NVP_MAX_NAME_LEN];
+    size_t matched, len;
+    long off;
+    const nt_node_t *node;
+
+    if (tree == NULL || cb == NULL)
+        return 0;
+
+    if (prefix == NULL)
+        prefix = "";
+
+    if ((len = strlen(prefix)) >= NVP_MAX_NAME_LEN ||
+        (off = nt_descend(tree, prefix, &matched)) < 0)
+        return 0;
+
+    /* Path of the found node may be longer than the prefix */
+    node = NT_NODE(tree, off);
+    memcpy(buf, prefix, len);
+    if (off != 0)
+    {
+        memcpy(buf + len, NT_LABEL(node) + matched, node->label_len - matched);
+        len += node->label_len - matched;
+    }
+
+    return nt_walk(tree, off, buf, len, cb, ctx);
+}
+
+int mmx_name_tree_add_message(mmx_name_tree_t *tree, const ep_message_t *message,
+                              uint32_t base_index)
+{
+    int status = FA_OK;
+    int i;
+
+    if (tree == NULL || message == NULL)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    switch (message->header.msgType)
+    {
+    case MSGTYPE_GETPARAMNAMES_RESP:
+        for (i = 0; i < message->body.getParamNamesResponse.arraySize && status == FA_OK; i++)
+            status = mmx_name_tree_insert(tree, message->body.getParamNamesResponse.paramInfo[i].name,
+                                          message->body.getParamNamesResponse.paramInfo[i].writable);
+        break;
+    case MSGTYPE_GETVALUE:
+        for (i = 0; i < message->body.getParamValue.arraySize && status == FA_OK; i++)
+            status = mmx_name_tree_insert(tree, message->body.getParamValue.paramNames[i],
+                                          base_index + i);
+        break;
+    case MSGTYPE_GETVALUE_RESP:
+        for (i = 0; i < message->body.getParamValueResponse.arraySize && status == FA_OK; i++)
+            status = mmx_name_tree_insert(tree, message->body.getParamValueResponse.paramValues[i].name,
+                                          base_index + i);
+        break;
+    case MSGTYPE_SETVALUE:
+        for (i = 0; i < message->body.setParamValue.arraySize && status == FA_OK; i++)
+            status = mmx_name_tree_insert(tree, message->body.setParamValue.paramValues[i].name,
+                                          base_index + i);
+        break;
+    default:
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Message type %d has no parameter names",
+                            message->header.msgType);
+    }
+
+    if (status != FA_OK)
+        ing_log(LOG_ERR, "Could not add name to the tree: %d\n", status);
+
+ret:
+    return status;
+}
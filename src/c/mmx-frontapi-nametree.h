@@ -0,0 +1,134 @@
+/* mmx-frontapi-nametree.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Name tree - compact store of parameter names.
+ *
+ * Names of one message (or of several fragments of one GetParamNames
+ * response) share long common prefixes. The name tree is a radix tree that
+ * keeps every common prefix only once, with an unsigned value per name
+ * (e.g. writable flag or index of the parameter in the message).
+ * Lookup takes O(length of the name); iteration returns names in
+ * lexicographical order.
+ *
+ * The tree is placed in the memory buffer supplied by the caller, nothing
+ * is allocated dynamically.
+ */
+
+#ifndef MMX_FRONTAPI_NAMETREE_H_
+#define MMX_FRONTAPI_NAMETREE_H_
+
+#include "mmx-frontapi.h"
+
+typedef struct mmx_name_tree_s {
+    char     *mem;      /* Memory buffer supplied by the caller */
+    uint32_t size;
+    uint32_t used;
+    uint32_t count;     /* Number of names in the tree */
+} mmx_name_tree_t;
+
+/*
+ * Iteration callback. Non-zero return value stops the iteration.
+ */
+typedef int (*mmx_name_tree_cb_t)(const char *name, uint32_t value, void *ctx);
+
+/*
+ * Initializes an empty tree in the specified memory buffer
+ */
+int mmx_name_tree_init(mmx_name_tree_t *tree, char *mem_buff, uint32_t mem_buff_size);
+
+/*
+ * Adds the name to the tree or updates value of the existing name.
+ * Returns FA_NOT_ENOUGH_MEMORY if the buffer is exhausted.
+ */
+int mmx_name_tree_insert(mmx_name_tree_t *tree, const char *name, uint32_t value);
+
+/*
+ * Looks up the name. Returns FA_OK and its value or FA_GENERAL_ERROR
+ * if the name is not in the tree.
+ */
+int mmx_name_tree_find(const mmx_name_tree_t *tree, const char *name, uint32_t *value);
+
+/*
+ * Calls 'cb' for every name that starts with 'prefix' (NULL or "" - for
+ * all names) in lexicographical order. Returns value of the callback that
+ * stopped the iteration or 0.
+ */
+int mmx_name_tree_foreach(const mmx_name_tree_t *tree, const char *prefix,
+                          mmx_name_tree_cb_t cb, void *ctx);
+
+/*
+ * Adds names of the parsed message to the tree:
+ *   GetParamNamesResponse - value is the writable flag
+ *   GetParamValue, GetParamValueResponse, SetParamValue - value is index
+ *   of the parameter in the message plus 'base_index'
+ */
+int mmx_name_tree_add_message(mmx_name_tree_t *tree, const ep_message_t *message,
+                              uint32_t base_index);
+
+#endif /* MMX_FRONTAPI_NAMETREE_H_ */
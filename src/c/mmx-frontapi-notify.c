@@ -0,0 +1,305 @@
+/* mmx-frontapi-notify.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Delivery of value-change notifications with coalescing
+ */
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-notify.h"
+
+static uint64_t notify_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void notify_deliver(mmx_notify_t *notify, uint32_t subscriptionId,
+                           const nvpair_t *values, int count)
+{
+    MMX_TRACE(notify, MMX_TRACE_NOTIFY, 0, MSGTYPE_NOTIFY, 0, (size_t)count, (int)subscriptionId);
+    notify->delivered++;
+    notify->cb(subscriptionId, values, count, notify->arg);
+}
+
+/* Merges the received changes into the pending ones */
+static void notify_merge(mmx_notify_t *notify, const ep_notify_t *body)
+{
+    const char *value;
+    size_t len;
+    uint32_t i;
+    int j;
+
+    /* Changes of different subscriptions are delivered separately */
+    if (notify->count && notify->subscriptionId != body->subscriptionId)
+        mmx_notify_flush(notify);
+
+    for (i = 0; i < body->arraySize; i++)
+    {
+        value = body->paramValues[i].pValue ? body->paramValues[i].pValue : "";
+        len = strlen(value) + 1;
+
+        for (j = 0; j < notify->count; j++)
+            if (!strcmp(notify->values[j].name, body->paramValues[i].name))
+                break;
+
+        if (j < notify->count)
+        {
+            notify->coalesced++;
+            if (strlen(notify->values[j].pValue) + 1 >= len)
+            {
+                memcpy(notify->values[j].pValue, value, len);
+                continue;
+            }
+        }
+
+        if (notify->pool_used + len > sizeof(notify->pool) ||
+            (j == notify->count && j == MAX_NUMBER_OF_RESPONSE_VALUES))
+        {
+            mmx_notify_flush(notify);
+            j = 0;
+        }
+
+        if (j == notify->count)
+        {
+            strcpy_safe(notify->values[j].name, body->paramValues[i].name,
+                        sizeof(notify->values[j].name));
+            notify->count++;
+        }
+        notify->values[j].pValue = notify->pool + notify->pool_used;
+        memcpy(notify->values[j].pValue, value, len);
+        notify->pool_used += len;
+    }
+
+    if (notify->count && notify->due_ns == 0)
+    {
+        notify->subscriptionId = body->subscriptionId;
+        notify->due_ns = notify_now_ns() + (uint64_t)notify->coalesce_ms * 1000000ULL;
+    }
+}
+
+/* Delivers the pending changes if they are due */
+static void notify_check_due(mmx_notify_t *notify)
+{
+    if (notify->due_ns && notify_now_ns() >= notify->due_ns)
+        mmx_notify_flush(notify);
+}
+
+int mmx_notify_init(mmx_notify_t *notify, mmx_notify_cb_t cb, void *arg, unsigned coalesce_ms)
+{
+    int status = FA_OK;
+
+    if (notify == NULL || cb == NULL)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    notify->cb = cb;
+    notify->arg = arg;
+    notify->coalesce_ms = coalesce_ms;
+    notify->due_ns = 0;
+    notify->subscriptionId = 0;
+    notify->count = 0;
+    notify->pool_used = 0;
+    notify->received = notify->changes = notify->coalesced = 0;
+    notify->delivered = notify->errors = 0;
+
+    memset(&notify->msg.header, 0, sizeof(notify->msg.header));
+    status = mmx_frontapi_msg_struct_init(&notify->msg, notify->msg_pool, sizeof(notify->msg_pool));
+
+ret:
+    return status;
+}
+
+void mmx_frontapi_set_notify(mmx_ep_connection_t *conn, mmx_notify_t *notify)
+{
+    conn->notify = notify;
+}
+
+void mmx_notify_input(mmx_ep_connection_t *conn, const char *xml)
+{
+    mmx_notify_t *notify = conn->notify;
+    ep_notify_t *body = &notify->msg.body.notify;
+
+    mmx_frontapi_msg_struct_reset(&notify->msg);
+    if (mmx_frontapi_message_parse_ex(xml, &notify->msg, conn->path_dict) != FA_OK ||
+        notify->msg.header.msgType != MSGTYPE_NOTIFY)
+    {
+        notify->errors++;
+        return;
+    }
+    notify->received++;
+    notify->changes += body->arraySize;
+
+    if (notify->coalesce_ms == 0)
+    {
+        /* Changes pending from the time coalescing was on go first */
+        if (notify->count)
+            mmx_notify_flush(notify);
+        if (body->arraySize)
+            notify_deliver(notify, body->subscriptionId, body->paramValues, (int)body->arraySize);
+        return;
+    }
+
+    notify_merge(notify, body);
+    notify_check_due(notify);
+}
+
+int mmx_notify_timeout_ms(const mmx_notify_t *notify)
+{
+    uint64_t now;
+
+    if (notify == NULL || notify->due_ns == 0)
+        return -1;
+
+    now = notify_now_ns();
+    if (now >= notify->due_ns)
+        return 0;
+    return (int)((notify->due_ns - now + 999999) / 1000000);
+}
+
+void mmx_notify_flush(mmx_notify_t *notify)
+{
+    int count = notify->count;
+
+    if (count == 0)
+        return;
+
+    /* The context may get new changes from the callback */
+    notify->count = 0;
+    notify->pool_used = 0;
+    notify->due_ns = 0;
+    notify_deliver(notify, notify->subscriptionId, notify->values, count);
+}
+
+int mmx_frontapi_dispatch(mmx_ep_connection_t *conn, unsigned timeout_ms)
+{
+    int status = FA_OK;
+    char buf[MMXFA_MAX_DATAGRAM_SIZE];
+    struct pollfd pfd;
+    ep_msg_header_t hdr;
+    uint64_t now, end;
+    int res, hdr_stat, wait_ms, due_ms;
+
+    if (conn == NULL || conn->sock < 0)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    now = notify_now_ns();
+    end = now + (uint64_t)timeout_ms * 1000000ULL;
+    pfd.fd = conn->sock;
+    pfd.events = POLLIN;
+
+    do
+    {
+        if (conn->notify)
+            notify_check_due(conn->notify);
+
+        wait_ms = (int)((end - now + 999999) / 1000000);
+        due_ms = mmx_notify_timeout_ms(conn->notify);
+        if (due_ms >= 0 && due_ms < wait_ms)
+            wait_ms = due_ms;
+
+        res = poll(&pfd, 1, wait_ms);
+        if (res < 0 && errno != EINTR)
+            GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not poll connection socket");
+
+        while (res > 0 && (res = recv(conn->sock, buf, sizeof(buf) - 1, MSG_DONTWAIT)) > 0)
+        {
+            MMX_STATS_COUNT(conn->stats, packets_received, 1);
+            MMX_STATS_COUNT(conn->stats, bytes_received, res);
+            buf[res] = '\0';
+
+            memset(&hdr, 0, sizeof(hdr));
+            hdr_stat = mmx_frontapi_msg_header_parse(buf, &hdr);
+            MMX_TRACE_HDR(receive, MMX_TRACE_RECEIVE, &hdr, (size_t)res, hdr_stat);
+            MMX_CAPTURE(conn, MMX_CAPTURE_DIR_RECEIVED, hdr.txaId, buf, res);
+
+            if (hdr_stat == FA_OK && hdr.msgType == MSGTYPE_NOTIFY && conn->notify)
+                mmx_notify_input(conn, buf);
+            else
+            {
+                MMX_STATS_COUNT(conn->stats, discarded, 1);
+                MMX_TRACE_HDR(discard, MMX_TRACE_DISCARD, &hdr, (size_t)res, hdr_stat);
+            }
+        }
+
+        now = notify_now_ns();
+    } while (now < end);
+
+    if (conn->notify)
+        notify_check_due(conn->notify);
+
+ret:
+    return status;
+}
@@ -0,0 +1,158 @@
+/* mmx-frontapi-notify.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Value-change notifications.
+ *
+ * A client subscribes to parameters with Subscribe request (see
+ * ep_subscribe_req_t, made with mmx_frontapi_make_request); the
+ * Entry-point then sends Notify messages with the changed values to the
+ * connection. Notify messages are handed to the notification context
+ * attached to the connection:
+ *  - while a request on the connection waits for its response,
+ *  - by mmx_frontapi_dispatch, which the client calls when it is idle,
+ *    e.g. when its event loop sees the connection socket readable or
+ *    mmx_notify_timeout_ms elapsed.
+ *
+ * With a coalescing interval the changes are not delivered at once: the
+ * changes received within the interval are merged (the last value of
+ * every parameter wins) and delivered together by one callback call.
+ *
+ * The callback is called in the thread using the connection and must not
+ * make requests on it. Values passed to the callback are valid only
+ * during the call.
+ */
+
+#ifndef MMX_FRONTAPI_NOTIFY_H_
+#define MMX_FRONTAPI_NOTIFY_H_
+
+#include <stdint.h>
+#include "mmx-frontapi.h"
+
+/* Size of the value pools of the context */
+#define MMX_NOTIFY_POOL_SIZE   MMXFA_MAX_DATAGRAM_SIZE
+
+typedef void (*mmx_notify_cb_t)(uint32_t subscriptionId, const nvpair_t *values,
+                                int count, void *arg);
+
+struct mmx_notify_s {
+    mmx_notify_cb_t cb;
+    void *arg;
+    unsigned coalesce_ms;
+
+    /* Changes waiting for delivery */
+    uint64_t due_ns;           /* CLOCK_MONOTONIC, 0 - nothing is pending */
+    uint32_t subscriptionId;
+    int count;
+    unsigned pool_used;
+    nvpair_t values[MAX_NUMBER_OF_RESPONSE_VALUES];
+    char pool[MMX_NOTIFY_POOL_SIZE];
+
+    /* The last received message */
+    ep_message_t msg;
+    char msg_pool[MMX_NOTIFY_POOL_SIZE];
+
+    /* Counters */
+    uint64_t received;         /* Notify messages */
+    uint64_t changes;          /* values in them */
+    uint64_t coalesced;        /* values replaced by newer ones before delivery */
+    uint64_t delivered;        /* callback calls */
+    uint64_t errors;           /* messages that could not be parsed */
+};
+
+/*
+ * Initializes the context. 'coalesce_ms' 0 - every Notify message is
+ * delivered when it is received.
+ */
+int mmx_notify_init(mmx_notify_t *notify, mmx_notify_cb_t cb, void *arg, unsigned coalesce_ms);
+
+/*
+ * Attaches the context to the connection (NULL detaches it; Notify
+ * messages are then discarded as unexpected packets)
+ */
+void mmx_frontapi_set_notify(mmx_ep_connection_t *conn, mmx_notify_t *notify);
+
+/*
+ * Receives packets of the connection for 'timeout_ms' (0 - only the
+ * already received ones) and delivers notifications. Other packets
+ * (e.g. late responses) are discarded.
+ */
+int mmx_frontapi_dispatch(mmx_ep_connection_t *conn, unsigned timeout_ms);
+
+/*
+ * Returns time in ms until the pending changes are due for delivery,
+ * -1 if there are no pending changes
+ */
+int mmx_notify_timeout_ms(const mmx_notify_t *notify);
+
+/*
+ * Delivers the pending changes now
+ */
+void mmx_notify_flush(mmx_notify_t *notify);
+
+#endif /* MMX_FRONTAPI_NOTIFY_H_ */
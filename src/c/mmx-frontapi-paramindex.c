@@ -0,0 +1,214 @@
+/* mmx-frontapi-paramindex.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Parameter index - hash lookup over parsed GetParamValue responses
+ */
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-paramindex.h"
+
+#define PI_VALUES(index)  ((index)->message->body.getParamValueResponse.paramValues)
+
+int mmx_param_index_build(mmx_param_index_t *index, const ep_message_t *message)
+{
+    int status = FA_OK;
+    int i, count;
+    uint32_t slot;
+
+    if (index == NULL || message == NULL)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    index->message = message;
+    index->count = 0;
+    index->sorted = 0;
+    memset(index->slots, 0, sizeof(index->slots));
+
+    if (message->header.msgType != MSGTYPE_GETVALUE_RESP)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Message type %d could not be indexed",
+                            message->header.msgType);
+
+    count = message->body.getParamValueResponse.arraySize;
+    if (count < 0 || count > MAX_NUMBER_OF_RESPONSE_VALUES)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Bad number of values %d", count);
+
+    for (i = 0; i < count; i++)
+    {
+        index->hashes[i] = mmx_hash(message->body.getParamValueResponse.paramValues[i].name, SIZE_MAX);
+
+        /* The first of duplicate names is found by the lookup */
+        slot = index->hashes[i] & (MMX_PARAM_INDEX_SIZE - 1);
+        while (index->slots[slot] != 0)
+            slot = (slot + 1) & (MMX_PARAM_INDEX_SIZE - 1);
+        index->slots[slot] = i + 1;
+    }
+    index->count = count;
+
+ret:
+    return status;
+}
+
+int mmx_frontapi_message_parse_indexed(const char *xmlmsg, ep_message_t *message,
+                                       mmx_path_dict_t *dict, mmx_param_index_t *index)
+{
+    int status;
+
+    if (index == NULL)
+        return FA_BAD_INPUT_PARAMS;
+
+    index->message = message;
+    index->count = 0;
+    index->sorted = 0;
+
+    status = mmx_frontapi_message_parse_ex(xmlmsg, message, dict);
+    if (status == FA_OK && message->header.msgType == MSGTYPE_GETVALUE_RESP)
+        status = mmx_param_index_build(index, message);
+
+    return status;
+}
+
+const nvpair_t *mmx_param_index_find(const mmx_param_index_t *index, const char *name)
+{
+    uint32_t h, slot;
+    int pos;
+
+    if (index == NULL || name == NULL || index->count == 0)
+        return NULL;
+
+    h = mmx_hash(name, SIZE_MAX);
+    slot = h & (MMX_PARAM_INDEX_SIZE - 1);
+
+    while (index->slots[slot] != 0)
+    {
+        pos = index->slots[slot] - 1;
+        if (index->hashes[pos] == h && !strcmp(PI_VALUES(index)[pos].name, name))
+            return &PI_VALUES(index)[pos];
+        slot = (slot + 1) & (MMX_PARAM_INDEX_SIZE - 1);
+    }
+    return NULL;
+}
+
+/* Insertion sort - there are not more than MAX_NUMBER_OF_RESPONSE_VALUES names */
+static void paramindex_sort(mmx_param_index_t *index)
+{
+    int i, j;
+    int16_t pos;
+
+    for (i = 0; i < index->count; i++)
+    {
+        pos = i;
+        for (j = i; j > 0 && strcmp(PI_VALUES(index)[index->order[j - 1]].name,
+                                    PI_VALUES(index)[pos].name) > 0; j--)
+            index->order[j] = index->order[j - 1];
+        index->order[j] = pos;
+    }
+    index->sorted = 1;
+}
+
+int mmx_param_index_subtree(mmx_param_index_t *index, const char *prefix, int *first)
+{
+    int lo, hi, mid;
+    size_t len;
+
+    if (index == NULL || prefix == NULL || index->count == 0)
+        return 0;
+
+    if (!index->sorted)
+        paramindex_sort(index);
+
+    /* Binary search of the first name not less than the prefix */
+    lo = 0;
+    hi = index->count;
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (strcmp(PI_VALUES(index)[index->order[mid]].name, prefix) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    len = strlen(prefix);
+    for (hi = lo; hi < index->count; hi++)
+    {
+        if (strncmp(PI_VALUES(index)[index->order[hi]].name, prefix, len))
+            break;
+    }
+
+    if (first)
+        *first = lo;
+    return hi - lo;
+}
+
+const nvpair_t *mmx_param_index_sorted(const mmx_param_index_t *index, int pos)
+{
+    if (index == NULL || !index->sorted || pos < 0 || pos >= index->count)
+        return NULL;
+
+    return &PI_VALUES(index)[index->order[pos]];
+}
@@ -0,0 +1,130 @@
+/* mmx-frontapi-paramindex.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Parameter index - O(1) lookup of parameters in parsed GetParamValue
+ * responses (instead of strcmp scans over paramValues array) and
+ * prefix-range queries for object subtrees.
+ *
+ * Usage:
+ *     mmx_frontapi_message_parse_indexed(xml, &msg, NULL, &index);
+ *     value = mmx_param_index_find(&index, "Device.DeviceInfo.UpTime");
+ *     cnt = mmx_param_index_subtree(&index, "Device.IP.Interface.1.", &first);
+ *     for (i = first; i < first + cnt; i++)
+ *         pair = mmx_param_index_sorted(&index, i);
+ *
+ * The index refers to the message; it is valid until the message is
+ * changed or parsed again.
+ */
+
+#ifndef MMX_FRONTAPI_PARAMINDEX_H_
+#define MMX_FRONTAPI_PARAMINDEX_H_
+
+#include "mmx-frontapi.h"
+
+#define MMX_PARAM_INDEX_SIZE   256   /* power of 2, at least twice the number of values */
+
+typedef struct mmx_param_index_s {
+    const ep_message_t *message;
+    int      count;
+    int      sorted;                                /* 'order' is filled in */
+    uint32_t hashes[MAX_NUMBER_OF_RESPONSE_VALUES];
+    int16_t  slots[MMX_PARAM_INDEX_SIZE];           /* position of value + 1, 0 - empty */
+    int16_t  order[MAX_NUMBER_OF_RESPONSE_VALUES];  /* positions sorted by name */
+} mmx_param_index_t;
+
+/*
+ * Builds the index over paramValues of parsed GetParamValueResponse
+ */
+int mmx_param_index_build(mmx_param_index_t *index, const ep_message_t *message);
+
+/*
+ * Parses the message (see mmx_frontapi_message_parse_ex) and builds the
+ * index if it is GetParamValueResponse. Otherwise index->count is 0.
+ */
+int mmx_frontapi_message_parse_indexed(const char *xmlmsg, ep_message_t *message,
+                                       mmx_path_dict_t *dict, mmx_param_index_t *index);
+
+/*
+ * Returns name-value pair of the parameter or NULL if it is not found
+ */
+const nvpair_t *mmx_param_index_find(const mmx_param_index_t *index, const char *name);
+
+/*
+ * Finds all parameters whose names start with 'prefix' (e.g. object
+ * instance path). Returns their number; 'first' receives position of the
+ * first one in the sorted order.
+ */
+int mmx_param_index_subtree(mmx_param_index_t *index, const char *prefix, int *first);
+
+/*
+ * Returns name-value pair at the position in the order sorted by name
+ */
+const nvpair_t *mmx_param_index_sorted(const mmx_param_index_t *index, int pos);
+
+#endif /* MMX_FRONTAPI_PARAMINDEX_H_ */
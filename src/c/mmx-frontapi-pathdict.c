@@ -0,0 +1,256 @@
+/* mmx-frontapi-pathdict.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Path dictionary - numeric Ids of parameter path prefixes
+ */
+#include <stdlib.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-pathdict.h"
+
+/* Returns slot of the hash table keeping Id of the prefix or an empty slot */
+static uint32_t pathdict_lookup(const mmx_path_dict_t *dict, const char *prefix, size_t len)
+{
+    uint32_t slot = mmx_hash(prefix, len) & (MMX_PATHDICT_HASH_SIZE - 1);
+    const mmx_path_dict_entry_t *e;
+
+    while (dict->hash[slot] != 0)
+    {
+        e = &dict->entries[dict->hash[slot]];
+        if (e->len == len && !memcmp(dict->pool + e->offset, prefix, len))
+            break;
+        slot = (slot + 1) & (MMX_PATHDICT_HASH_SIZE - 1);
+    }
+    return slot;
+}
+
+int mmx_path_dict_init(mmx_path_dict_t *dict, int role, uint32_t generation,
+                       char *mem_buff, uint32_t mem_buff_size)
+{
+    int status = FA_OK;
+
+    if (dict == NULL || mem_buff == NULL || mem_buff_size == 0)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    dict->role = role;
+    dict->pool = mem_buff;
+    dict->pool_size = mem_buff_size;
+    mmx_path_dict_reset(dict, generation);
+
+ret:
+    return status;
+}
+
+void mmx_path_dict_reset(mmx_path_dict_t *dict, uint32_t generation)
+{
+    dict->generation = generation;
+    dict->count = 0;
+    dict->next_id = 1;
+    dict->used_count = 0;
+    dict->pool_offset = 0;
+    memset(dict->entries, 0, sizeof(dict->entries));
+    memset(dict->hash, 0, sizeof(dict->hash));
+}
+
+uint16_t mmx_path_dict_add(mmx_path_dict_t *dict, const char *prefix, size_t len, uint16_t id)
+{
+    uint32_t slot;
+
+    if (len == 0 || len > 0xffff || id > MMX_PATHDICT_MAX_ENTRIES)
+        return 0;
+
+    slot = pathdict_lookup(dict, prefix, len);
+    if (dict->hash[slot] != 0)
+        return (id == 0 || id == dict->hash[slot]) ? dict->hash[slot] : 0;
+
+    if (id == 0)
+    {
+        if (dict->next_id > MMX_PATHDICT_MAX_ENTRIES)
+            return 0;
+        id = dict->next_id;
+    }
+    else if (dict->entries[id].len != 0)
+        return 0;   /* Id is already used for another prefix */
+
+    if (dict->count >= MMX_PATHDICT_HASH_SIZE / 2 ||
+        dict->pool_size - dict->pool_offset < len)
+        return 0;
+
+    memcpy(dict->pool + dict->pool_offset, prefix, len);
+    dict->entries[id].offset = dict->pool_offset;
+    dict->entries[id].len = len;
+    dict->pool_offset += len;
+
+    dict->hash[slot] = id;
+    dict->count++;
+    if (id >= dict->next_id)
+        dict->next_id = id + 1;
+
+    return id;
+}
+
+const char *mmx_path_dict_get(const mmx_path_dict_t *dict, uint16_t id, size_t *len)
+{
+    if (dict == NULL || id == 0 || id > MMX_PATHDICT_MAX_ENTRIES || dict->entries[id].len == 0)
+        return NULL;
+
+    *len = dict->entries[id].len;
+    return dict->pool + dict->entries[id].offset;
+}
+
+void mmx_path_dict_mark_used(mmx_path_dict_t *dict, uint16_t id)
+{
+    if (id == 0 || id > MMX_PATHDICT_MAX_ENTRIES || dict->entries[id].len == 0 ||
+        dict->entries[id].used)
+        return;
+
+    dict->entries[id].used = 1;
+    dict->used_count++;
+}
+
+void mmx_path_dict_clear_used(mmx_path_dict_t *dict)
+{
+    uint16_t id;
+
+    for (id = 1; dict->used_count != 0 && id < dict->next_id; id++)
+    {
+        if (dict->entries[id].used)
+        {
+            dict->entries[id].used = 0;
+            dict->used_count--;
+        }
+    }
+}
+
+uint16_t mmx_path_dict_find_prefix(const mmx_path_dict_t *dict, const char *name,
+                                   size_t *prefix_len)
+{
+    size_t i;
+    uint32_t slot;
+
+    if (dict == NULL || dict->count == 0 ||
+        (dict->role == MMX_PATHDICT_ROLE_EP && dict->used_count == 0))
+        return 0;
+
+    for (i = strlen(name); i >= MMX_PATHDICT_MIN_PREFIX_LEN; i--)
+    {
+        if (name[i - 1] != '.')
+            continue;
+
+        slot = pathdict_lookup(dict, name, i);
+        if (dict->hash[slot] != 0 &&
+            (dict->role != MMX_PATHDICT_ROLE_EP || dict->entries[dict->hash[slot]].used))
+        {
+            *prefix_len = i;
+            return dict->hash[slot];
+        }
+    }
+    return 0;
+}
+
+void mmx_path_dict_follow(mmx_path_dict_t *dict, uint32_t generation)
+{
+    if (dict == NULL || dict->generation == generation)
+        return;
+
+    /* Client follows generation of the dictionary owned by the Entry-point */
+    if (dict->role == MMX_PATHDICT_ROLE_CLIENT)
+        mmx_path_dict_reset(dict, generation);
+    /* Client that does not know the generation has not received any Id */
+    else
+        mmx_path_dict_clear_used(dict);
+}
+
+const char *mmx_path_dict_decode(mmx_path_dict_t *dict, uint32_t generation,
+                                 const char *id_str, size_t *len)
+{
+    const char *prefix = NULL;
+    uint16_t id = (uint16_t)strtol(id_str, NULL, 10);
+
+    if (dict != NULL && generation == dict->generation)
+        prefix = mmx_path_dict_get(dict, id, len);
+
+    if (prefix == NULL)
+    {
+        ing_log(LOG_ERR, "Unknown path dictionary Id %s (generation %u)\n",
+                id_str, generation);
+        return NULL;
+    }
+
+    if (dict->role == MMX_PATHDICT_ROLE_EP)
+        mmx_path_dict_mark_used(dict, id);
+
+    return prefix;
+}
+
+void mmx_frontapi_set_path_dict(mmx_ep_connection_t *conn, mmx_path_dict_t *dict)
+{
+    conn->path_dict = dict;
+}
@@ -0,0 +1,181 @@
+/* mmx-frontapi-pathdict.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Path dictionary - optional protocol extension that allows to send
+ * parameter names as numeric prefix Id plus suffix.
+ *
+ * Protocol:
+ *  - the Entry-point owns the dictionary of the client and assigns Ids to
+ *    object paths (names ending by ".") that it returns in GetParamNames
+ *    responses: <name pdDef="Id">Device.WiFi.AccessPoint.3.</name>
+ *  - every message built with a dictionary carries its generation in the
+ *    header (<pathDict>); the client sends generation it knows (0 at start),
+ *    the Entry-point always answers with generation of its dictionary
+ *  - when both sides use the same generation, names of parameters may be
+ *    sent as <name pd="Id">suffix</name>, where full name is prefix Id + suffix
+ *  - if the client receives other generation, it drops all learned prefixes
+ *    (e.g. the Entry-point was restarted), so no stale Ids are ever sent
+ *  - the Entry-point encodes names of a response only if the request carried
+ *    its generation, and only with Ids the client has used in its requests
+ *    (so it surely received them). A response defining Ids may be lost, so
+ *    the Ids are defined again in every GetParamNames response. A request
+ *    with other generation (a new or legacy client) makes the Entry-point
+ *    forget which Ids were used.
+ *
+ * The builder and the parser handle the dictionary transparently when it is
+ * attached to the connection (mmx_frontapi_set_path_dict) or passed to
+ * mmx_frontapi_message_build_ex/mmx_frontapi_message_parse_ex.
+ */
+
+#ifndef MMX_FRONTAPI_PATHDICT_H_
+#define MMX_FRONTAPI_PATHDICT_H_
+
+#include "mmx-frontapi.h"
+
+#define MMX_PATHDICT_MAX_ENTRIES   1024
+#define MMX_PATHDICT_HASH_SIZE     2048   /* must be power of 2 */
+
+/* Prefixes shorter than this are not worth encoding */
+#define MMX_PATHDICT_MIN_PREFIX_LEN  12
+
+/* Dictionary role */
+#define MMX_PATHDICT_ROLE_CLIENT   0   /* learns Ids and generation from responses */
+#define MMX_PATHDICT_ROLE_EP       1   /* assigns Ids and owns the generation */
+
+typedef struct mmx_path_dict_entry_s {
+    uint32_t offset;     /* Offset of the prefix in the string pool */
+    uint16_t len;        /* Length of the prefix, 0 - entry is not used */
+    uint16_t used;       /* EP role: the client sent the Id, so it knows it */
+} mmx_path_dict_entry_t;
+
+struct mmx_path_dict_s {
+    int       role;
+    uint32_t  generation;  /* 0 - dictionary is not in use */
+    uint16_t  count;       /* Number of used entries */
+    uint16_t  next_id;     /* Next Id to be assigned (EP role) */
+    uint16_t  used_count;  /* Number of Ids used by the client (EP role) */
+    char      *pool;       /* String pool supplied by the caller */
+    uint32_t  pool_size;
+    uint32_t  pool_offset;
+    mmx_path_dict_entry_t entries[MMX_PATHDICT_MAX_ENTRIES + 1]; /* Id 0 is not used */
+    uint16_t  hash[MMX_PATHDICT_HASH_SIZE]; /* Ids of entries, 0 - empty slot */
+};
+
+/*
+ * Initializes the dictionary. The caller must supply memory buffer that
+ * will be used for keeping prefix strings.
+ * Client passes generation 0, Entry-point - any non-zero value that differs
+ * from generations used before (e.g. based on start time)
+ */
+int mmx_path_dict_init(mmx_path_dict_t *dict, int role, uint32_t generation,
+                       char *mem_buff, uint32_t mem_buff_size);
+
+/*
+ * Drops all prefixes and sets new generation of the dictionary
+ */
+void mmx_path_dict_reset(mmx_path_dict_t *dict, uint32_t generation);
+
+/*
+ * Adds prefix to the dictionary. If 'id' is 0 a new Id is assigned (EP role),
+ * otherwise the prefix is stored under the specified Id (client role).
+ * Returns Id of the prefix (the existing one if the prefix is already known)
+ * or 0 if the prefix could not be added.
+ */
+uint16_t mmx_path_dict_add(mmx_path_dict_t *dict, const char *prefix, size_t len, uint16_t id);
+
+/*
+ * Returns prefix with the specified Id (not null-terminated) or NULL
+ */
+const char *mmx_path_dict_get(const mmx_path_dict_t *dict, uint16_t id, size_t *len);
+
+/*
+ * Marks the Id as received by the client (EP role): it was used in a request
+ */
+void mmx_path_dict_mark_used(mmx_path_dict_t *dict, uint16_t id);
+
+/*
+ * Forgets which Ids were used by the client (EP role)
+ */
+void mmx_path_dict_clear_used(mmx_path_dict_t *dict);
+
+/*
+ * Finds the longest prefix of 'name' (ending by ".") present in the
+ * dictionary (in EP role - only the used ones). Returns its Id and length
+ * or 0 if there is no such prefix.
+ */
+uint16_t mmx_path_dict_find_prefix(const mmx_path_dict_t *dict, const char *name,
+                                   size_t *prefix_len);
+
+/*
+ * Attaches the dictionary to the connection; it will be used by
+ * mmx_frontapi_make_request. NULL disables the extension.
+ */
+void mmx_frontapi_set_path_dict(mmx_ep_connection_t *conn, mmx_path_dict_t *dict);
+
+#endif /* MMX_FRONTAPI_PATHDICT_H_ */
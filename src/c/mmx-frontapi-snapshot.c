@@ -0,0 +1,601 @@
+/* mmx-frontapi-snapshot.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Published parameter snapshot in shared memory (seqlock hash table)
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-snapshot.h"
+
+#define SNAPSHOT_ROUND(size) \
+    (((size) + MMX_SNAPSHOT_ALIGN - 1) & ~(size_t)(MMX_SNAPSHOT_ALIGN - 1))
+
+#define SNAPSHOT_HDR_SIZE   SNAPSHOT_ROUND(sizeof(mmx_snapshot_file_hdr_t))
+
+#define SNAPSHOT_ENTRY(hdr, i) \
+    ((mmx_snapshot_entry_t *)((char *)(hdr) + (hdr)->hdr_size + (size_t)(i) * (hdr)->entry_size))
+
+static uint32_t snapshot_hash(const char *str)
+{
+    uint32_t h = mmx_hash(str, SIZE_MAX);
+
+    return h ? h : 1;    /* 0 marks unused entries */
+}
+
+static uint64_t snapshot_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * Returns entry of the name or the unused entry where it would be added,
+ * NULL if the name is not found and the table has no unused entries
+ */
+static mmx_snapshot_entry_t *snapshot_find(const mmx_snapshot_file_hdr_t *hdr,
+                                           const char *name, uint32_t h)
+{
+    mmx_snapshot_entry_t *e;
+    uint32_t i, hash, mask = hdr->entries - 1;
+    uint32_t slot = h & mask;
+
+    for (i = 0; i < hdr->entries; i++)
+    {
+        e = SNAPSHOT_ENTRY(hdr, slot);
+
+        /* Name of the entry is written before its hash */
+        hash = __atomic_load_n(&e->hash, __ATOMIC_ACQUIRE);
+        if (hash == 0 || (hash == h && !strcmp(e->name, name)))
+            return e;
+
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
+}
+
+static int snapshot_map(mmx_snapshot_t *snap, int fd, size_t size, int writable)
+{
+    void *addr = mmap(NULL, size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                      MAP_SHARED, fd, 0);
+
+    if (addr == MAP_FAILED)
+        return FA_GENERAL_ERROR;
+
+    memset(snap, 0, sizeof(*snap));
+    snap->fd = fd;
+    snap->writable = writable;
+    snap->size = size;
+    snap->hdr = (mmx_snapshot_file_hdr_t *)addr;
+    return FA_OK;
+}
+
+/* Marks the snapshot file (if any) at the opened path as replaced */
+static void snapshot_mark_replaced(int fd)
+{
+    struct stat st;
+    mmx_snapshot_file_hdr_t *hdr;
+
+    if (fd < 0 || fstat(fd, &st) != 0 || (size_t)st.st_size < SNAPSHOT_HDR_SIZE)
+        return;
+
+    hdr = mmap(NULL, SNAPSHOT_HDR_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (hdr == MAP_FAILED)
+        return;
+
+    if (!memcmp(hdr->magic, MMX_SNAPSHOT_MAGIC, sizeof(hdr->magic)) &&
+        hdr->version == MMX_SNAPSHOT_VERSION)
+        __atomic_store_n(&hdr->replaced, 1, __ATOMIC_RELEASE);
+
+    munmap(hdr, SNAPSHOT_HDR_SIZE);
+}
+
+int mmx_snapshot_create(mmx_snapshot_t *snap, const char *path,
+                        unsigned entries, unsigned value_size)
+{
+    int status = FA_OK;
+    int fd = -1, old_fd = -1;
+    int mapped = 0;
+    uint32_t size = 2;
+    size_t entry_size, file_size;
+    char tmp_path[MMX_SNAPSHOT_PATH_LEN + 16];
+
+    if (snap == NULL || path == NULL || entries == 0 || entries > (1U << 24) ||
+        value_size == 0 || value_size > (1U << 20) || strlen(path) >= MMX_SNAPSHOT_PATH_LEN)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    while (size < entries)
+        size <<= 1;
+    entry_size = SNAPSHOT_ROUND(sizeof(mmx_snapshot_entry_t) + value_size);
+    file_size = SNAPSHOT_HDR_SIZE + size * entry_size;
+
+    /*
+     * The file mapped by readers is never truncated (they would get SIGBUS):
+     * the new file is prepared under a temporary name and renamed over it
+     */
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%d.tmp", path, (int)getpid());
+    unlink(tmp_path);
+    fd = open(tmp_path, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not create snapshot file %s", tmp_path);
+
+    if (ftruncate(fd, (off_t)file_size) != 0)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not set size of snapshot file %s", tmp_path);
+
+    if (snapshot_map(snap, fd, file_size, 1) != FA_OK)
+        GOTO_RET_WITH_ERROR(FA_NOT_ENOUGH_MEMORY, "Could not map snapshot file %s", tmp_path);
+    mapped = 1;
+    strcpy_safe(snap->path, path, sizeof(snap->path));
+
+    snap->hdr->version = MMX_SNAPSHOT_VERSION;
+    snap->hdr->hdr_size = SNAPSHOT_HDR_SIZE;
+    snap->hdr->entries = size;
+    snap->hdr->entry_size = (uint32_t)entry_size;
+    snap->hdr->value_size = value_size;
+
+    /* Magic is written last: readers attaching meanwhile reject the file */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(snap->hdr->magic, MMX_SNAPSHOT_MAGIC, sizeof(snap->hdr->magic));
+
+    /* Readers of the old file re-attach after the rename */
+    old_fd = open(path, O_RDWR);
+    if (rename(tmp_path, path) != 0)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not rename snapshot file %s", tmp_path);
+    snapshot_mark_replaced(old_fd);
+
+ret:
+    if (old_fd >= 0)
+        close(old_fd);
+    if (status != FA_OK && fd >= 0)
+    {
+        if (mapped)
+        {
+            munmap(snap->hdr, snap->size);
+            snap->hdr = NULL;
+        }
+        close(fd);
+        unlink(tmp_path);
+    }
+    return status;
+}
+
+int mmx_snapshot_attach(mmx_snapshot_t *snap, const char *path)
+{
+    int status = FA_OK;
+    int fd = -1;
+    struct stat st;
+    const mmx_snapshot_file_hdr_t *hdr;
+
+    if (snap == NULL || path == NULL || strlen(path) >= MMX_SNAPSHOT_PATH_LEN)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0)
+        GOTO_RET_WITH_ERROR(FA_GENERAL_ERROR, "Could not open snapshot file %s", path);
+
+    if ((size_t)st.st_size < SNAPSHOT_HDR_SIZE)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Snapshot file %s is too short", path);
+
+    if (snapshot_map(snap, fd, (size_t)st.st_size, 0) != FA_OK)
+        GOTO_RET_WITH_ERROR(FA_NOT_ENOUGH_MEMORY, "Could not map snapshot file %s", path);
+
+    hdr = snap->hdr;
+    if (memcmp(hdr->magic, MMX_SNAPSHOT_MAGIC, sizeof(hdr->magic)) ||
+        hdr->version != MMX_SNAPSHOT_VERSION || hdr->hdr_size < sizeof(*hdr) ||
+        hdr->entries == 0 || (hdr->entries & (hdr->entries - 1)) ||
+        hdr->entry_size < sizeof(mmx_snapshot_entry_t) + hdr->value_size ||
+        hdr->hdr_size + (uint64_t)hdr->entries * hdr->entry_size > snap->size)
+    {
+        munmap(snap->hdr, snap->size);
+        snap->hdr = NULL;
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "%s is not a snapshot file", path);
+    }
+    strcpy_safe(snap->path, path, sizeof(snap->path));
+
+ret:
+    if (status != FA_OK && fd >= 0)
+        close(fd);
+    return status;
+}
+
+int mmx_snapshot_close(mmx_snapshot_t *snap)
+{
+    int i;
+
+    if (snap == NULL || snap->hdr == NULL)
+        return FA_BAD_INPUT_PARAMS;
+
+    munmap(snap->hdr, snap->size);
+    close(snap->fd);
+    snap->hdr = NULL;
+
+    for (i = 0; i < snap->retired_count; i++)
+        munmap(snap->retired[i].addr, snap->retired[i].size);
+    snap->retired_count = 0;
+    return FA_OK;
+}
+
+/*
+ * Unmaps the mappings of replaced files if no reader is in
+ * mmx_snapshot_get: readers coming later see the current mapping
+ */
+static void snapshot_free_retired(mmx_snapshot_t *snap)
+{
+    int i;
+
+    if (snap->retired_count == 0 || __atomic_load_n(&snap->readers, __ATOMIC_SEQ_CST) != 0)
+        return;
+
+    for (i = 0; i < snap->retired_count; i++)
+        munmap(snap->retired[i].addr, snap->retired[i].size);
+    __atomic_store_n(&snap->retired_count, 0, __ATOMIC_RELAXED);
+}
+
+int mmx_snapshot_reattach(mmx_snapshot_t *snap)
+{
+    int status = FA_OK;
+    int busy = 0;
+    int replaced;
+    mmx_snapshot_file_hdr_t *hdr;
+    mmx_snapshot_t next;
+
+    if (snap == NULL || snap->writable)
+        return FA_BAD_INPUT_PARAMS;
+
+    /* The header is read as by mmx_snapshot_get */
+    __atomic_fetch_add(&snap->readers, 1, __ATOMIC_SEQ_CST);
+    hdr = __atomic_load_n(&snap->hdr, __ATOMIC_SEQ_CST);
+    replaced = hdr != NULL && __atomic_load_n(&hdr->replaced, __ATOMIC_ACQUIRE);
+    __atomic_fetch_sub(&snap->readers, 1, __ATOMIC_RELEASE);
+
+    if (hdr == NULL)
+        return FA_BAD_INPUT_PARAMS;
+    if (!replaced && __atomic_load_n(&snap->retired_count, __ATOMIC_RELAXED) == 0)
+        return FA_OK;
+
+    /* One thread re-attaches, the others keep asking the Entry-point */
+    if (!__atomic_compare_exchange_n(&snap->reattaching, &busy, 1, 0,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        return replaced ? FA_GENERAL_ERROR : FA_OK;
+
+    snapshot_free_retired(snap);
+    if (!replaced)
+        goto ret;
+
+    /* Readers did not leave the old mappings all the time: reported once */
+    if (snap->retired_count >= MMX_SNAPSHOT_MAX_RETIRED)
+    {
+        if (!snap->retired_full)
+            ing_log(LOG_ERR, "Snapshot file %s is replaced, old mappings are still read\n",
+                    snap->path);
+        snap->retired_full = 1;
+        status = FA_GENERAL_ERROR;
+        goto ret;
+    }
+
+    status = mmx_snapshot_attach(&next, snap->path);
+    if (status != FA_OK)
+        goto ret;
+
+    /* Replaced again meanwhile; the next call retries */
+    if (__atomic_load_n(&next.hdr->replaced, __ATOMIC_ACQUIRE))
+    {
+        munmap(next.hdr, next.size);
+        close(next.fd);
+        status = FA_GENERAL_ERROR;
+        goto ret;
+    }
+
+    /* Other threads may still read the old mapping */
+    snap->retired[snap->retired_count].addr = snap->hdr;
+    snap->retired[snap->retired_count].size = snap->size;
+    __atomic_store_n(&snap->retired_count, snap->retired_count + 1, __ATOMIC_RELAXED);
+    snap->retired_full = 0;
+    close(snap->fd);
+
+    snap->fd = next.fd;
+    snap->size = next.size;
+    __atomic_store_n(&snap->hdr, next.hdr, __ATOMIC_SEQ_CST);
+    snapshot_free_retired(snap);
+
+ret:
+    __atomic_store_n(&snap->reattaching, 0, __ATOMIC_RELEASE);
+    return status;
+}
+
+int mmx_snapshot_publish(mmx_snapshot_t *snap, const char *name, const char *value)
+{
+    int status = FA_OK;
+    mmx_snapshot_file_hdr_t *hdr;
+    mmx_snapshot_entry_t *e;
+    size_t len = 0;
+    uint32_t h, seq;
+
+    if (snap == NULL || snap->hdr == NULL || !snap->writable || name == NULL ||
+        *name == '\0' || strlen(name) >= NVP_MAX_NAME_LEN)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    hdr = snap->hdr;
+    if (value && (len = strlen(value)) >= hdr->value_size)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Value of %s is too long (%zu bytes)", name, len);
+
+    h = snapshot_hash(name);
+    e = snapshot_find(hdr, name, h);
+
+    if (e == NULL || e->hash == 0)
+    {
+        if (value == NULL)
+            goto ret;
+        if (e == NULL || hdr->count >= hdr->entries / 2)
+            GOTO_RET_WITH_ERROR(FA_NOT_ENOUGH_MEMORY, "Snapshot is full, %s is not published", name);
+
+        /* New entry is not visible to readers until its hash is set */
+        strcpy_safe(e->name, name, sizeof(e->name));
+        memcpy(e->value, value, len + 1);
+        e->value_len = (uint32_t)len;
+        e->ts_ns = snapshot_now_ns();
+        __atomic_store_n(&e->hash, h, __ATOMIC_RELEASE);
+        hdr->count++;
+    }
+    else
+    {
+        seq = e->seq;
+        __atomic_store_n(&e->seq, seq + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        if (value)
+        {
+            memcpy(e->value, value, len + 1);
+            e->value_len = (uint32_t)len;
+            e->ts_ns = snapshot_now_ns();
+        }
+        else
+            e->ts_ns = 0;
+
+        __atomic_store_n(&e->seq, seq + 2, __ATOMIC_RELEASE);
+    }
+    __atomic_fetch_add(&hdr->generation, 1, __ATOMIC_RELEASE);
+
+ret:
+    return status;
+}
+
+int mmx_snapshot_publish_message(mmx_snapshot_t *snap, const ep_message_t *message)
+{
+    int status = FA_OK;
+    const ep_getParamValue_resp_t *body;
+    uint32_t i;
+
+    if (message == NULL || message->header.msgType != MSGTYPE_GETVALUE_RESP)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    body = &message->body.getParamValueResponse;
+    if (body->arraySize > MAX_NUMBER_OF_RESPONSE_VALUES)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Bad number of values %u", body->arraySize);
+
+    for (i = 0; i < body->arraySize; i++)
+    {
+        status = mmx_snapshot_publish(snap, body->paramValues[i].name,
+                                      body->paramValues[i].pValue ? body->paramValues[i].pValue : "");
+        if (status != FA_OK)
+            goto ret;
+    }
+
+ret:
+    return status;
+}
+
+/* Copies value of the entry of the name in the mapped file */
+static int snapshot_read(const mmx_snapshot_file_hdr_t *hdr, const char *name,
+                         char *value, size_t value_size, uint64_t *ts_ns)
+{
+    const mmx_snapshot_entry_t *e;
+    uint32_t seq, len;
+    uint64_t ts;
+    int i;
+
+    e = snapshot_find(hdr, name, snapshot_hash(name));
+    if (e == NULL || __atomic_load_n(&e->hash, __ATOMIC_RELAXED) == 0)
+        return 0;
+
+    for (i = 0; i < MMX_SNAPSHOT_READ_RETRIES; i++)
+    {
+        seq = __atomic_load_n(&e->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1)
+            continue;
+
+        ts = __atomic_load_n(&e->ts_ns, __ATOMIC_RELAXED);
+        len = __atomic_load_n(&e->value_len, __ATOMIC_RELAXED);
+        if (ts == 0 || len >= hdr->value_size || len >= value_size)
+            ts = 0;
+        else
+            memcpy(value, e->value, len);
+
+        /* The copy is valid if the entry was not updated meanwhile */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&e->seq, __ATOMIC_RELAXED) != seq)
+            continue;
+
+        if (ts == 0)
+            return 0;
+
+        value[len] = '\0';
+        if (ts_ns)
+            *ts_ns = ts;
+        return 1;
+    }
+    return 0;
+}
+
+int mmx_snapshot_get(mmx_snapshot_t *snap, const char *name,
+                     char *value, size_t value_size, uint64_t *ts_ns)
+{
+    const mmx_snapshot_file_hdr_t *hdr;
+    int res = 0;
+
+    if (snap == NULL || name == NULL || value == NULL || value_size == 0)
+        return 0;
+
+    /* The mapping is not freed by re-attach while the reader is counted */
+    __atomic_fetch_add(&snap->readers, 1, __ATOMIC_SEQ_CST);
+    hdr = __atomic_load_n(&snap->hdr, __ATOMIC_SEQ_CST);
+    if (hdr != NULL && !__atomic_load_n(&hdr->replaced, __ATOMIC_ACQUIRE))
+        res = snapshot_read(hdr, name, value, value_size, ts_ns);
+    __atomic_fetch_sub(&snap->readers, 1, __ATOMIC_RELEASE);
+
+    return res;
+}
+
+int mmx_snapshot_make_request(mmx_ep_connection_t *conn, mmx_snapshot_t *snap,
+                              ep_message_t *msg, unsigned max_age_ms, int *more)
+{
+    ep_getParamValue_req_t *req;
+    ep_getParamValue_resp_t *resp;
+    ep_msg_mempool_t *pool;
+    unsigned short offsets[MAX_NUMBER_OF_RESPONSE_VALUES];
+    unsigned short pool_start;
+    uint64_t now, ts;
+    size_t len;
+    int i, count;
+
+    if (snap == NULL || snap->hdr == NULL || msg == NULL ||
+        msg->header.msgType != MSGTYPE_GETVALUE || !msg->mem_pool.initialized)
+        goto remote;
+
+    if (mmx_snapshot_reattach(snap) != FA_OK)
+        goto remote;
+
+    req = &msg->body.getParamValue;
+    resp = &msg->body.getParamValueResponse;
+    pool = &msg->mem_pool;
+    count = (int)req->arraySize;
+    if (req->nextLevel || count <= 0 || count > MAX_NUMBER_OF_RESPONSE_VALUES ||
+        count > MSG_MAX_NUMBER_OF_GET_PARAMS)
+        goto remote;
+
+    /* Values are copied to the memory pool of the message */
+    now = snapshot_now_ns();
+    pool_start = pool->curr_offset;
+    for (i = 0; i < count; i++)
+    {
+        len = strnlen(req->paramNames[i], sizeof(req->paramNames[i]));
+        if (len == 0 || len == sizeof(req->paramNames[i]) || req->paramNames[i][len - 1] == '.')
+            break;
+
+        if (!mmx_snapshot_get(snap, req->paramNames[i], pool->pool + pool->curr_offset,
+                              pool->size_bytes - pool->curr_offset, &ts))
+            break;
+        if (max_age_ms && (now < ts ? 0 : now - ts) > (uint64_t)max_age_ms * 1000000ULL)
+            break;
+
+        offsets[i] = pool->curr_offset;
+        pool->curr_offset += strlen(pool->pool + pool->curr_offset) + 1;
+    }
+    if (i < count)
+    {
+        pool->curr_offset = pool_start;
+        goto remote;
+    }
+
+    /*
+     * Request and response share the body; the name of the i-th value
+     * is not placed before the i-th requested name, so the names are
+     * moved starting from the last one
+     */
+    for (i = count - 1; i >= 0; i--)
+    {
+        memmove(resp->paramValues[i].name, req->paramNames[i], sizeof(resp->paramValues[i].name));
+        resp->paramValues[i].pValue = pool->pool + offsets[i];
+    }
+    resp->arraySize = (uint32_t)count;
+    resp->totalNVSize = 0;
+
+    msg->header.msgType = MSGTYPE_GETVALUE_RESP;
+    msg->header.respCode = MMX_API_RC_OK;
+    msg->header.moreFlag = 0;
+    if (more)
+        *more = 0;
+
+    __atomic_fetch_add(&snap->local, 1, __ATOMIC_RELAXED);
+    return FA_OK;
+
+remote:
+    if (snap)
+        __atomic_fetch_add(&snap->remote, 1, __ATOMIC_RELAXED);
+    return mmx_frontapi_make_request(conn, msg, more);
+}
@@ -0,0 +1,228 @@
+/* mmx-frontapi-snapshot.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Published parameter snapshot.
+ *
+ * A backend (publisher) writes values of selected parameters into a
+ * shared-memory file organized as a hash table of parameter name to
+ * value. Frontends (readers) map the same file and serve GetParamValue
+ * requests for the published names locally, without round trips to the
+ * Entry-point (mmx_snapshot_make_request); other requests go to the
+ * Entry-point as usual.
+ *
+ * Readers take no locks: every entry is protected by a sequence counter
+ * (seqlock) that is odd while the publisher updates the entry, readers
+ * copy the value and retry if the counter changed. Entries are never
+ * freed, so the name of a used entry does not change.
+ *
+ * Every value carries the time of its publication; readers pass the
+ * maximum age they accept, older values are requested from the
+ * Entry-point.
+ *
+ * Usage:
+ *     publisher: mmx_snapshot_create(&snap, MMX_SNAPSHOT_DEFAULT_PATH, 1024, 256);
+ *                mmx_snapshot_publish(&snap, "Device.DeviceInfo.UpTime", "3600");
+ *     reader:    mmx_snapshot_attach(&snap, MMX_SNAPSHOT_DEFAULT_PATH);
+ *                mmx_snapshot_make_request(&conn, &snap, &msg, 1000, &more);
+ *
+ * There is one publisher per file; its calls must not run concurrently.
+ * A (restarted) publisher creates a new file and renames it over the old
+ * one, which is marked as replaced; readers of the old file then ask the
+ * Entry-point until they re-attach to the new file (done by
+ * mmx_snapshot_make_request). The mapped file is never truncated; the old
+ * mapping is freed once no reader is in mmx_snapshot_get.
+ * File layout: mmx_snapshot_file_hdr_t, then 'entries' entries of
+ * 'entry_size' bytes (mmx_snapshot_entry_t followed by the value).
+ */
+
+#ifndef MMX_FRONTAPI_SNAPSHOT_H_
+#define MMX_FRONTAPI_SNAPSHOT_H_
+
+#include <stdint.h>
+#include "mmx-frontapi.h"
+
+#define MMX_SNAPSHOT_MAGIC          "MMXSNP1"
+#define MMX_SNAPSHOT_VERSION        2
+#define MMX_SNAPSHOT_DEFAULT_PATH   "/dev/shm/mmx-frontapi.snapshot"
+
+/* Entries are aligned to this size */
+#define MMX_SNAPSHOT_ALIGN          8
+
+/* Reader gives up (and asks the Entry-point) after so many concurrent updates */
+#define MMX_SNAPSHOT_READ_RETRIES   64
+
+#define MMX_SNAPSHOT_PATH_LEN       256
+
+/* Mappings of replaced files still read by other threads */
+#define MMX_SNAPSHOT_MAX_RETIRED    8
+
+typedef struct mmx_snapshot_file_hdr_s {
+    char     magic[8];
+    uint32_t version;
+    uint32_t hdr_size;     /* Offset of the first entry */
+    uint32_t entries;      /* Size of the hash table, power of 2 */
+    uint32_t entry_size;
+    uint32_t value_size;   /* Max value length + 1 */
+    uint32_t count;        /* Number of used entries */
+    uint64_t generation;   /* Incremented by every publication */
+    uint32_t replaced;     /* 1 - a new file was created, the values are not updated */
+    uint32_t reserved;
+} mmx_snapshot_file_hdr_t;
+
+typedef struct mmx_snapshot_entry_s {
+    uint32_t seq;          /* Odd while the entry is being updated */
+    uint32_t hash;         /* Hash of the name, 0 - entry is not used */
+    uint64_t ts_ns;        /* CLOCK_REALTIME of publication, 0 - value is removed */
+    uint32_t value_len;
+    uint32_t reserved;
+    char     name[NVP_MAX_NAME_LEN];
+    char     value[0];
+} mmx_snapshot_entry_t;
+
+typedef struct mmx_snapshot_mapping_s {
+    void *addr;
+    size_t size;
+} mmx_snapshot_mapping_t;
+
+typedef struct mmx_snapshot_s {
+    int fd;
+    int writable;
+    size_t size;
+    mmx_snapshot_file_hdr_t *hdr;  /* replaced atomically on re-attach */
+    char path[MMX_SNAPSHOT_PATH_LEN];
+    /* Re-attach of the reader */
+    int reattaching;
+    int readers;           /* threads in mmx_snapshot_get */
+    int retired_count;
+    int retired_full;      /* no free slot was reported */
+    mmx_snapshot_mapping_t retired[MMX_SNAPSHOT_MAX_RETIRED];
+    /* Requests of the reader (updated atomically) */
+    uint64_t local;        /* served from the snapshot */
+    uint64_t remote;       /* sent to the Entry-point */
+} mmx_snapshot_t;
+
+/*
+ * Creates the snapshot file with hash table of 'entries' entries (rounded
+ * up to power of 2; at most half of them may be used) keeping values up to
+ * 'value_size' - 1 bytes, and maps it for writing. An existing file is
+ * replaced (see above), not overwritten.
+ */
+int mmx_snapshot_create(mmx_snapshot_t *snap, const char *path,
+                        unsigned entries, unsigned value_size);
+
+/*
+ * Maps the existing snapshot file for reading
+ */
+int mmx_snapshot_attach(mmx_snapshot_t *snap, const char *path);
+
+/*
+ * Unmaps the file. The file itself is kept, so readers may use it
+ * until a publisher creates it again.
+ */
+int mmx_snapshot_close(mmx_snapshot_t *snap);
+
+/*
+ * Publishes value of the parameter (NULL value removes it)
+ */
+int mmx_snapshot_publish(mmx_snapshot_t *snap, const char *name, const char *value);
+
+/*
+ * Publishes all values of parsed GetParamValueResponse, e.g. the subtree
+ * the backend keeps up to date
+ */
+int mmx_snapshot_publish_message(mmx_snapshot_t *snap, const ep_message_t *message);
+
+/*
+ * Reads published value of the parameter. Returns 1 and fills 'value'
+ * and the time of publication (CLOCK_REALTIME, ns) if the value is
+ * published, 0 otherwise (also if it is longer than 'value_size' - 1,
+ * is being updated all the time or the file was replaced).
+ */
+int mmx_snapshot_get(mmx_snapshot_t *snap, const char *name,
+                     char *value, size_t value_size, uint64_t *ts_ns);
+
+/*
+ * Re-attaches the reader to the file at the path if its file was replaced.
+ * May run concurrently with the other reader calls: the old mapping is
+ * kept until no reader is in mmx_snapshot_get (at the latest until
+ * mmx_snapshot_close). Returns FA_OK if the reader uses a current file.
+ */
+int mmx_snapshot_reattach(mmx_snapshot_t *snap);
+
+/*
+ * Does the same as mmx_frontapi_make_request, but GetParamValue request
+ * is answered from the snapshot if all requested parameters are published
+ * and their values are not older than 'max_age_ms' (0 - any age).
+ * Requests of object paths, other requests and requests with any missing
+ * or stale parameter are sent to the Entry-point.
+ */
+int mmx_snapshot_make_request(mmx_ep_connection_t *conn, mmx_snapshot_t *snap,
+                              ep_message_t *msg, unsigned max_age_ms, int *more);
+
+#endif /* MMX_FRONTAPI_SNAPSHOT_H_ */
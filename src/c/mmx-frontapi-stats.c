@@ -0,0 +1,191 @@
+/* mmx-frontapi-stats.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Runtime statistics of Entry-point connections
+ */
+#include <string.h>
+#include <time.h>
+
+#include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-stats.h"
+
+#define STATS_ADD(ptr, val)   __atomic_fetch_add((ptr), (val), __ATOMIC_RELAXED)
+#define STATS_LOAD(ptr)       __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#define STATS_TAKE(ptr)       __atomic_exchange_n((ptr), 0, __ATOMIC_RELAXED)
+
+static const char *phase_names[MMX_STATS_PHASE_LAST] = {
+    "build", "send", "wait", "parse", "total"
+};
+
+uint64_t mmx_stats_now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static unsigned hist_bucket(uint64_t us)
+{
+    unsigned bucket = 0;
+
+    while (us && bucket < MMX_STATS_HIST_BUCKETS - 1)
+    {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void hist_add(mmx_stats_hist_t *hist, uint64_t us)
+{
+    uint64_t max = STATS_LOAD(&hist->max_us);
+
+    STATS_ADD(&hist->count, 1);
+    STATS_ADD(&hist->sum_us, us);
+    STATS_ADD(&hist->buckets[hist_bucket(us)], 1);
+
+    while (us > max &&
+           !__atomic_compare_exchange_n(&hist->max_us, &max, us, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+}
+
+uint64_t mmx_stats_record(mmx_ep_stats_t *stats, mmx_stats_phase_t phase, uint64_t since)
+{
+    uint64_t now = mmx_stats_now_us();
+
+    hist_add(&stats->phases[phase], now > since ? now - since : 0);
+    return now;
+}
+
+void mmx_stats_finish(mmx_ep_stats_t *stats, msgtype_t type, int status, uint64_t start)
+{
+    mmx_stats_record(stats, MMX_STATS_PHASE_TOTAL, start);
+
+    if (type < 0 || type >= MSGTYPE_LAST)
+        return;
+    STATS_ADD(&stats->requests[type], 1);
+    if (status != FA_OK)
+        STATS_ADD(&stats->errors[type], 1);
+}
+
+void mmx_stats_count(uint64_t *counter, uint64_t val)
+{
+    STATS_ADD(counter, val);
+}
+
+void mmx_frontapi_stats_init(mmx_ep_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+void mmx_frontapi_set_stats(mmx_ep_connection_t *conn, mmx_ep_stats_t *stats)
+{
+    conn->stats = stats;
+}
+
+void mmx_frontapi_stats_snapshot(mmx_ep_stats_t *stats, mmx_ep_stats_t *snapshot, int reset)
+{
+    /* The block consists of uint64_t counters only */
+    uint64_t *src = (uint64_t *)stats, *dst = (uint64_t *)snapshot;
+    size_t i, n = sizeof(*stats) / sizeof(uint64_t);
+
+    for (i = 0; i < n; i++)
+        dst[i] = reset ? STATS_TAKE(&src[i]) : STATS_LOAD(&src[i]);
+}
+
+uint64_t mmx_frontapi_stats_percentile(const mmx_stats_hist_t *hist, double q)
+{
+    uint64_t rank, seen = 0;
+    unsigned i;
+
+    if (hist->count == 0)
+        return 0;
+
+    rank = (uint64_t)(q * hist->count + 0.999999);
+    if (rank == 0)
+        rank = 1;
+
+    for (i = 0; i < MMX_STATS_HIST_BUCKETS - 1; i++)
+    {
+        seen += hist->buckets[i];
+        if (seen >= rank)
+            return ((uint64_t)1 << i) < hist->max_us ? ((uint64_t)1 << i) : hist->max_us;
+    }
+    return hist->max_us;
+}
+
+const char *mmx_frontapi_stats_phase2str(mmx_stats_phase_t phase)
+{
+    if (phase < 0 || phase >= MMX_STATS_PHASE_LAST)
+        return "unknown";
+    return phase_names[phase];
+}
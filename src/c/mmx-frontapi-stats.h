@@ -0,0 +1,151 @@
+/* mmx-frontapi-stats.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Runtime statistics of Entry-point connections.
+ *
+ * A statistics block is attached to one or more connections (it may be
+ * shared by connections of several threads: all updates are lock-free
+ * atomic additions). The library then counts requests and failed requests
+ * per message type, response timeouts, received packets discarded because
+ * of wrong txaId, and keeps log2 latency histograms of every phase of
+ * mmx_frontapi_make_request/mmx_frontapi_make_xml_request.
+ * Connections without statistics block pay nothing.
+ */
+
+#ifndef MMX_FRONTAPI_STATS_H_
+#define MMX_FRONTAPI_STATS_H_
+
+#include <stdint.h>
+
+#include "mmx-frontapi.h"
+
+/*
+ * Latency histogram buckets: bucket 0 - less than 1 us,
+ * bucket i - [2^(i-1), 2^i) us, the last bucket - 2^(N-2) us and more
+ */
+#define MMX_STATS_HIST_BUCKETS  26
+
+/* Phases of a request */
+typedef enum mmx_stats_phase_e {
+    MMX_STATS_PHASE_BUILD = 0,  /* building of request XML */
+    MMX_STATS_PHASE_SEND,       /* sending of request datagram */
+    MMX_STATS_PHASE_WAIT,       /* waiting for the first response packet */
+    MMX_STATS_PHASE_PARSE,      /* parsing of the response */
+    MMX_STATS_PHASE_TOTAL,      /* whole request */
+    MMX_STATS_PHASE_LAST
+} mmx_stats_phase_t;
+
+typedef struct mmx_stats_hist_s {
+    uint64_t count;
+    uint64_t sum_us;
+    uint64_t max_us;
+    uint64_t buckets[MMX_STATS_HIST_BUCKETS];
+} mmx_stats_hist_t;
+
+struct mmx_ep_stats_s {
+    uint64_t requests[MSGTYPE_LAST];  /* requests by message type */
+    uint64_t errors[MSGTYPE_LAST];    /* failed requests by message type */
+    uint64_t timeouts;        /* no response with expected txaId in time */
+    uint64_t discarded;       /* received packets with other txaId or bad header */
+    uint64_t send_errors;
+    uint64_t packets_sent;
+    uint64_t packets_received;
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+    mmx_stats_hist_t phases[MMX_STATS_PHASE_LAST];
+};
+
+/*
+ * Clears the statistics block
+ */
+void mmx_frontapi_stats_init(mmx_ep_stats_t *stats);
+
+/*
+ * Attaches the statistics block to the connection. NULL disables statistics.
+ */
+void mmx_frontapi_set_stats(mmx_ep_connection_t *conn, mmx_ep_stats_t *stats);
+
+/*
+ * Copies the statistics to 'snapshot'. If 'reset' is set, every counter
+ * is atomically swapped with 0, so no update is lost between snapshots.
+ */
+void mmx_frontapi_stats_snapshot(mmx_ep_stats_t *stats, mmx_ep_stats_t *snapshot, int reset);
+
+/*
+ * Returns the upper bound (us) of the histogram bucket containing q-th
+ * quantile (0 < q <= 1), limited by max_us
+ */
+uint64_t mmx_frontapi_stats_percentile(const mmx_stats_hist_t *hist, double q);
+
+/*
+ * Returns name of the phase
+ */
+const char *mmx_frontapi_stats_phase2str(mmx_stats_phase_t phase);
+
+#endif /* MMX_FRONTAPI_STATS_H_ */
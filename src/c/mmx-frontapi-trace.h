@@ -0,0 +1,139 @@
+/* mmx-frontapi-trace.h
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Tracing of request processing.
+ *
+ * The library reports events at every phase of a request: message build,
+ * send, receive, header parse, full parse, discarded packet (waiting for
+ * the response is retried), response timeout, received response fragment
+ * and delivered value-change notification. Every event carries txaId,
+ * msgType and callerId of the message, a size and a status (see
+ * mmx_trace_point_t).
+ *
+ * Events are delivered:
+ *  - to the callback set by mmx_frontapi_set_trace_cb (process-wide),
+ *  - as USDT probes of provider "mmx_frontapi" if the library is built
+ *    with USDT=1 (needs sys/sdt.h). Disabled probes are single nop
+ *    instructions and may be attached in production without rebuilding,
+ *    e.g. bpftrace -e 'usdt:/usr/lib/libmmx-frontapi.so:mmx_frontapi:timeout
+ *    { printf("txaId %d\n", arg0); }'
+ *    Probe arguments: txaId, msgType, callerId, size, status.
+ */
+
+#ifndef MMX_FRONTAPI_TRACE_H_
+#define MMX_FRONTAPI_TRACE_H_
+
+#include <stddef.h>
+
+/* Trace points (USDT probe names are given in brackets) */
+typedef enum mmx_trace_point_e {
+    MMX_TRACE_BUILD = 0,     /* [build] message is built; size - XML bytes */
+    MMX_TRACE_SEND,          /* [send] request is sent; size - packet bytes */
+    MMX_TRACE_RECEIVE,       /* [receive] packet is received; size - packet bytes,
+                                status - result of its header parse */
+    MMX_TRACE_HEADER_PARSE,  /* [header_parse] header is parsed; size - 0 */
+    MMX_TRACE_PARSE,         /* [parse] message is parsed; size - number of
+                                items in the body (e.g. name-value pairs) */
+    MMX_TRACE_DISCARD,       /* [discard] received packet is not the awaited
+                                response, waiting is retried; size - packet bytes */
+    MMX_TRACE_TIMEOUT,       /* [timeout] no response in time; txaId - awaited one,
+                                size - number of discarded packets */
+    MMX_TRACE_FRAGMENT,      /* [fragment] response fragment is received;
+                                size - packet bytes, status - moreFlag
+                                (0 - the response is complete) */
+    MMX_TRACE_NOTIFY,        /* [notify] changes are delivered to the
+                                notification callback; txaId - 0, size -
+                                number of values, status - subscriptionId */
+    MMX_TRACE_LAST
+} mmx_trace_point_t;
+
+typedef struct mmx_trace_event_s {
+    mmx_trace_point_t point;
+    int txaId;
+    int msgType;
+    int callerId;
+    size_t size;
+    int status;
+} mmx_trace_event_t;
+
+typedef void (*mmx_trace_cb_t)(const mmx_trace_event_t *event, void *arg);
+
+/*
+ * Sets the callback called (in the thread of the request) for every
+ * trace event. NULL disables the callback. It should be set before the
+ * threads using the library are started.
+ */
+void mmx_frontapi_set_trace_cb(mmx_trace_cb_t cb, void *arg);
+
+/*
+ * Returns name of the trace point (the same as name of the USDT probe)
+ */
+const char *mmx_frontapi_trace_point2str(mmx_trace_point_t point);
+
+#endif /* MMX_FRONTAPI_TRACE_H_ */
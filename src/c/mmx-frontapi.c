@@ -72,17 +72,11 @@
 #include <arpa/inet.h>
 
 #include "mmx-frontapi.h"
+#include "mmx-frontapi-internal.h"
+#include "mmx-frontapi-pathdict.h"
 #include "ing_gen_utils.h"
 #include <sys/time.h> // for gettimeofday function
 
-#define FA_BUF_SIZE     2048
-
-#define GOTO_RET_WITH_ERROR(err_num, msg, ...)     do { \
-    ing_log(LOG_ERR, msg"\n", ##__VA_ARGS__); \
-    status = err_num; \
-    goto ret; \
-} while (0)
-
 #define XML_GET_INT(tree, name, to)     do { \
     mxml_node_t *node = mxmlFindElement(tree, tree, name, NULL, NULL, MXML_DESCEND); \
     if (node == NULL) \
@@ -152,7 +146,79 @@ static const char *bool2str(char flag)
     return flag ? "true" : "false";
 }
 
-static int xml_parse_body_getvalue(ep_message_t *message, mxml_node_t *tree)
+/* Number of items (parameters, objects) in the body of the parsed message */
+static size_t msg_body_items(const ep_message_t *message)
+{
+    switch (message->header.msgType)
+    {
+    case MSGTYPE_GETVALUE: return message->body.getParamValue.arraySize;
+    case MSGTYPE_GETVALUE_RESP: return message->body.getParamValueResponse.arraySize;
+    case MSGTYPE_SETVALUE: return message->body.setParamValue.arraySize;
+    case MSGTYPE_SETVALUE_RESP:
+        return message->header.respCode ? message->body.setParamValueFaultResponse.arraySize : 0;
+    case MSGTYPE_GETPARAMNAMES_RESP: return message->body.getParamNamesResponse.arraySize;
+    case MSGTYPE_ADDOBJECT: return message->body.addObject.arraySize;
+    case MSGTYPE_DELOBJECT: return message->body.delObject.arraySize;
+    case MSGTYPE_SUBSCRIBE: return message->body.subscribe.arraySize;
+    case MSGTYPE_NOTIFY: return message->body.notify.arraySize;
+    default: return 0;
+    }
+}
+
+/*
+ * Copies parameter name from the node. If the name is encoded with the
+ * path dictionary (prefix Id + suffix), full name is restored; Entry-point
+ * notes that the client knows the Id.
+ */
+static int xml_get_name(mxml_node_t *node, const ep_message_t *message,
+                        mmx_path_dict_t *dict, char *to, size_t size)
+{
+    const char *s = mxmlGetOpaque(node);
+    const char *id_str = mxmlElementGetAttrValue(node, MSG_STR_ATTR_PATHDICT);
+    const char *prefix;
+    size_t len = 0;
+
+    if (id_str != NULL)
+    {
+        prefix = mmx_path_dict_decode(dict, message->header.pathDict, id_str, &len);
+        if (prefix == NULL)
+            return FA_INVALID_FORMAT;
+
+        if (len >= size)
+            len = size - 1;
+        memcpy(to, prefix, len);
+    }
+
+    strcpy_safe(to + len, s ? s : "", size - len);
+    return FA_OK;
+}
+
+/*
+ * Creates name element for the parameter. The name is encoded with
+ * the path dictionary if it has a known prefix.
+ */
+static mxml_node_t *xml_new_name(mxml_node_t *parent, const char *name,
+                                 const mmx_path_dict_t *dict)
+{
+    char buf[MSG_SHORT_STR_LEN];
+    size_t len;
+    uint16_t id;
+    mxml_node_t *node = mxmlNewElement(parent, MSG_STR_NAME);
+
+    if (dict != NULL && dict->generation != 0 &&
+        (id = mmx_path_dict_find_prefix(dict, name, &len)) != 0)
+    {
+        sprintf(buf, "%u", id);
+        mxmlElementSetAttr(node, MSG_STR_ATTR_PATHDICT, buf);
+        name += len;
+    }
+
+    mxmlNewText(node, 0, name);
+    return node;
+}
+
+static int xml_parse_body_getvalue(ep_message_t *message, mxml_node_t *tree,
+                                   mmx_path_dict_t *dict)
 {
     int  status = FA_OK;
     int  i = 0;
@@ -193,8 +259,9 @@ static int xml_parse_body_getvalue(ep_message_t *message, mxml_node_t *tree)
             node != NULL && i < arraySize;
             node = mxmlFindElement(node, tree, MSG_STR_NAME, NULL, NULL, MXML_DESCEND), i++)
     {
-        s = (char *)mxmlGetOpaque(node);
-        strncpy(message->body.getParamValue.paramNames[i], s ? s : "", NVP_MAX_NAME_LEN);
+        if (xml_get_name(node, message, dict, message->body.getParamValue.paramNames[i],
+                         NVP_MAX_NAME_LEN) != FA_OK)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: bad parameter name");
     }
     if (i != arraySize)
         GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Number of parameters does not match arraySize attribute");
@@ -220,6 +287,11 @@ msgtype_t msgtype2num(const char *str)
     else if (!strcmp(str, MSG_STR_INITACTIONS)) return MSGTYPE_INITACTIONS;
     else if (!strcmp(str, MSG_STR_REBOOT)) return MSGTYPE_REBOOT;
     else if (!strcmp(str, MSG_STR_RESET)) return MSGTYPE_RESET;
+    else if (!strcmp(str, MSG_STR_SUBSCRIBE)) return MSGTYPE_SUBSCRIBE;
+    else if (!strcmp(str, MSG_STR_SUBSCRIBE_RESP)) return MSGTYPE_SUBSCRIBE_RESP;
+    else if (!strcmp(str, MSG_STR_UNSUBSCRIBE)) return MSGTYPE_UNSUBSCRIBE;
+    else if (!strcmp(str, MSG_STR_UNSUBSCRIBE_RESP)) return MSGTYPE_UNSUBSCRIBE_RESP;
+    else if (!strcmp(str, MSG_STR_NOTIFY)) return MSGTYPE_NOTIFY;
 
     return MSGTYPE_ERR;
 }
@@ -243,6 +315,11 @@ const char *msgtype2str(msgtype_t t)
     case MSGTYPE_INITACTIONS:    return MSG_STR_INITACTIONS;
     case MSGTYPE_REBOOT:         return MSG_STR_REBOOT;
     case MSGTYPE_RESET:          return MSG_STR_RESET;
+    case MSGTYPE_SUBSCRIBE:      return MSG_STR_SUBSCRIBE;
+    case MSGTYPE_SUBSCRIBE_RESP: return MSG_STR_SUBSCRIBE_RESP;
+    case MSGTYPE_UNSUBSCRIBE:    return MSG_STR_UNSUBSCRIBE;
+    case MSGTYPE_UNSUBSCRIBE_RESP: return MSG_STR_UNSUBSCRIBE_RESP;
+    case MSGTYPE_NOTIFY:         return MSG_STR_NOTIFY;
     /* TODO the rest */
     default: return "Unknown";
     }
@@ -274,7 +351,8 @@ char * mmxdbtype_num2str(const mmx_dbtype_t dbtype)
     }
 }
 
-static int xml_parse_body_getvalue_resp(ep_message_t *message, mxml_node_t *tree)
+static int xml_parse_body_getvalue_resp(ep_message_t *message, mxml_node_t *tree,
+                                        mmx_path_dict_t *dict)
 {
     int status = FA_OK, res = FA_OK;
     int i = 0;
@@ -282,7 +360,7 @@ static int xml_parse_body_getvalue_resp(ep_message_t *message, mxml_node_t *tree
     const char *arraySizeStr;
     char *s, *name;
 
-    mxml_node_t *node = NULL, *subnode = NULL;
+    mxml_node_t *node = NULL, *subnode = NULL, *namenode = NULL;
     
     if(!message->mem_pool.initialized)
         GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS,
@@ -314,6 +392,7 @@ static int xml_parse_body_getvalue_resp(ep_message_t *message, mxml_node_t *tree
         if (!subnode)
             GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: pair name missing");
         name = (char *)mxmlGetOpaque(subnode);
+        namenode = subnode;
 
         subnode = mxmlFindElement(node, tree, MSG_STR_VALUE, NULL, NULL, MXML_DESCEND);
         if (!subnode)
@@ -327,8 +406,9 @@ static int xml_parse_body_getvalue_resp(ep_message_t *message, mxml_node_t *tree
             GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, 
                 "Not enough space in the pool for param %s (size %d)",name, s ? s : "");
 
-        strncpy(message->body.getParamValueResponse.paramValues[i].name, 
-                                           name ? name : "", NVP_MAX_NAME_LEN);   
+        if (xml_get_name(namenode, message, dict, message->body.getParamValueResponse.paramValues[i].name,
+                         NVP_MAX_NAME_LEN) != FA_OK)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: bad parameter name");   
     }
     if (i != arraySize)
         GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Number of parameters does not match arraySize attribute");
@@ -340,7 +420,8 @@ ret:
 #define TR_069_SET_FAULTCODE_FROM  9000
 #define TR_069_SET_FAULTCODE_TO    9008
 
-static int xml_parse_body_setvalue_resp(ep_message_t *message, mxml_node_t *tree)
+static int xml_parse_body_setvalue_resp(ep_message_t *message, mxml_node_t *tree,
+                                        mmx_path_dict_t *dict)
 {
     int status = FA_OK;
     int i = 0, faultcode = 0;
@@ -395,8 +476,10 @@ static int xml_parse_body_setvalue_resp(ep_message_t *message, mxml_node_t *tree
             subnode = mxmlFindElement(node, tree, MSG_STR_NAME, NULL, NULL, MXML_DESCEND);
             if (!subnode)
                 GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: pair name missing");
-            s = (char *)mxmlGetOpaque(subnode);
-            strncpy(message->body.setParamValueFaultResponse.paramFaults[i].name, s ? s : "", NVP_MAX_NAME_LEN);
+            if (xml_get_name(subnode, message, dict,
+                             message->body.setParamValueFaultResponse.paramFaults[i].name,
+                             sizeof(message->body.setParamValueFaultResponse.paramFaults[i].name)) != FA_OK)
+                GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: bad parameter name");
             
             subnode = mxmlFindElement(node, tree, MSG_STR_FAULTCODE, NULL, NULL, MXML_DESCEND);
             if (!subnode)
@@ -416,7 +499,8 @@ ret:
     return status;
 }
 
-static int xml_parse_body_setvalue(ep_message_t *message, mxml_node_t *tree)
+static int xml_parse_body_setvalue(ep_message_t *message, mxml_node_t *tree,
+                                   mmx_path_dict_t *dict)
 {
     int status = FA_OK, res = FA_OK;
     int i = 0;
@@ -424,7 +508,7 @@ static int xml_parse_body_setvalue(ep_message_t *message, mxml_node_t *tree)
     char *s, *name;
     const char *arraySizeStr;
 
-    mxml_node_t *node = NULL, *subnode = NULL;
+    mxml_node_t *node = NULL, *subnode = NULL, *namenode = NULL;
     
     if(!message->mem_pool.initialized)
         GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS,
@@ -459,6 +543,7 @@ static int xml_parse_body_setvalue(ep_message_t *message, mxml_node_t *tree)
         if (!subnode)
             GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: pair name missing");
         name = (char *)mxmlGetOpaque(subnode);
+        namenode = subnode;
         
         subnode = mxmlFindElement(node, tree, MSG_STR_VALUE, NULL, NULL, MXML_DESCEND);
         if (!subnode)
@@ -470,8 +555,9 @@ static int xml_parse_body_setvalue(ep_message_t *message, mxml_node_t *tree)
             GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, 
                 "Not enough space in the pool for param %s (size %d)",name, s ? s : "");
 
-        strncpy(message->body.setParamValue.paramValues[i].name, name ? name : "",
-                                                               NVP_MAX_NAME_LEN);
+        if (xml_get_name(namenode, message, dict, message->body.setParamValue.paramValues[i].name,
+                         NVP_MAX_NAME_LEN) != FA_OK)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: bad parameter name");
     }
     if (i != arraySize)
         GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Number of parameters does not match arraySize attribute");
@@ -498,13 +584,14 @@ ret:
     return status;
 }
 
-static int xml_parse_body_getparamnames_resp(ep_message_t *message, mxml_node_t *tree)
+static int xml_parse_body_getparamnames_resp(ep_message_t *message, mxml_node_t *tree,
+                                             mmx_path_dict_t *dict)
 {
     int status = FA_OK;
     int i = 0;
     long int arraySize;
     char *s;
-    const char *arraySizeStr;
+    const char *arraySizeStr, *pathDef;
 
     mxml_node_t *node = NULL, *subnode = NULL;
     XML_GET_NODE(tree, tree, MSG_STR_GETPARAMNAMES_RESP, node);
@@ -534,6 +621,13 @@ static int xml_parse_body_getparamnames_resp(ep_message_t *message, mxml_node_t
         s = (char *)mxmlGetOpaque(subnode);
         strncpy(message->body.getParamNamesResponse.paramInfo[i].name, s ? s : "",
                                                                NVP_MAX_NAME_LEN);
+
+        /* Learn Id assigned by the Entry-point to the object path */
+        pathDef = mxmlElementGetAttrValue(subnode, MSG_STR_ATTR_PATHDEF);
+        if (pathDef != NULL && s != NULL && dict != NULL &&
+            dict->role == MMX_PATHDICT_ROLE_CLIENT &&
+            message->header.pathDict == dict->generation && dict->generation != 0)
+            mmx_path_dict_add(dict, s, strlen(s), (uint16_t)strtol(pathDef, NULL, 10));
         subnode = mxmlFindElement(node, tree, MSG_STR_WRITABLE, NULL, NULL, MXML_DESCEND);
         if (!subnode)
             GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: pair writable missing");
@@ -548,7 +642,8 @@ ret:
     return status;
 }
 
-static int xml_parse_body_addobject(ep_message_t *message, mxml_node_t *tree)
+static int xml_parse_body_addobject(ep_message_t *message, mxml_node_t *tree,
+                                    mmx_path_dict_t *dict)
 {
     int status = FA_OK, res = FA_OK;
     int i = 0;
@@ -556,7 +651,7 @@ static int xml_parse_body_addobject(ep_message_t *message, mxml_node_t *tree)
     char *s, *name;
     const char *arraySizeStr;
 
-    mxml_node_t *node = NULL, *subnode = NULL;
+    mxml_node_t *node = NULL, *subnode = NULL, *namenode = NULL;
     
     if(!message->mem_pool.initialized)
         GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS,
@@ -591,6 +686,7 @@ static int xml_parse_body_addobject(ep_message_t *message, mxml_node_t *tree)
         if (!subnode)
             GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: pair name missing");
         name = (char *)mxmlGetOpaque(subnode);
+        namenode = subnode;
         
         subnode = mxmlFindElement(node, tree, MSG_STR_VALUE, NULL, NULL, MXML_DESCEND);
         if (!subnode)
@@ -602,8 +698,9 @@ static int xml_parse_body_addobject(ep_message_t *message, mxml_node_t *tree)
             GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, 
                 "Not enough space in the pool for param %s (size %d)",name, s ? s : "");
 
-        strncpy(message->body.addObject.paramValues[i].name, name ? name : "",
-                                                               NVP_MAX_NAME_LEN);
+        if (xml_get_name(namenode, message, dict, message->body.addObject.paramValues[i].name,
+                         NVP_MAX_NAME_LEN) != FA_OK)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: bad parameter name");
     }
     if (i != arraySize)
         GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Number of parameters does not match arraySize attribute");
@@ -723,7 +820,194 @@ ret:
     return status;
 }
 
+static int xml_parse_body_subscribe(ep_message_t *message, mxml_node_t *tree,
+                                    mmx_path_dict_t *dict)
+{
+    int status = FA_OK;
+    int i = 0;
+    long int arraySize;
+    const char *arraySizeStr;
+    mxml_node_t *node = NULL;
+
+    XML_GET_NODE(tree, tree, MSG_STR_SUBSCRIBE, node);
+
+    message->body.subscribe.minInterval = 0;
+    if (mxmlFindElement(tree, tree, MSG_STR_MININTERVAL, NULL, NULL, MXML_DESCEND))
+    {
+        XML_GET_POSITIVE_OR_NULL_INT(tree, MSG_STR_MININTERVAL, message->body.subscribe.minInterval);
+    }
+
+    XML_GET_NODE(node, tree, MSG_STR_PARAMNAMES, node);
+
+    arraySizeStr = mxmlElementGetAttrValue(node, MSG_STR_ATTR_ARRAYSIZE);
+    if (arraySizeStr == NULL)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Attribute `%s' in not set",
+                                                            MSG_STR_ATTR_ARRAYSIZE);
+
+    arraySize = strtol(arraySizeStr, NULL, 10);
+    if (arraySize <= 0 || arraySize > MSG_MAX_NUMBER_OF_GET_PARAMS)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT,
+          "Incorrect value of attribute %s - %ld (max value is %d)",
+              MSG_STR_ATTR_ARRAYSIZE, arraySize, MSG_MAX_NUMBER_OF_GET_PARAMS);
+
+    message->body.subscribe.arraySize = arraySize;
+
+    for (node = mxmlFindElement(node, tree, MSG_STR_NAME, NULL, NULL, MXML_DESCEND);
+            node != NULL && i < arraySize;
+            node = mxmlFindElement(node, tree, MSG_STR_NAME, NULL, NULL, MXML_DESCEND), i++)
+    {
+        if (xml_get_name(node, message, dict, message->body.subscribe.paramNames[i],
+                         NVP_MAX_NAME_LEN) != FA_OK)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: bad parameter name");
+    }
+    if (i != arraySize)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Number of parameters does not match arraySize attribute");
+
+ret:
+    return status;
+}
+
+static int xml_parse_body_subscribe_resp(ep_message_t *message, mxml_node_t *tree)
+{
+    int status = FA_OK;
+    mxml_node_t *node = NULL;
+
+    XML_GET_NODE(tree, tree, MSG_STR_SUBSCRIBE_RESP, node);
+
+    XML_GET_INT(tree, MSG_STR_SUBSCRIPTIONID, message->body.subscribeResponse.subscriptionId);
+    XML_GET_INT(tree, MSG_STR_STATUS, message->body.subscribeResponse.status);
+
+ret:
+    return status;
+}
+
+static int xml_parse_body_unsubscribe(ep_message_t *message, mxml_node_t *tree)
+{
+    int status = FA_OK;
+    mxml_node_t *node = NULL;
+
+    XML_GET_NODE(tree, tree, MSG_STR_UNSUBSCRIBE, node);
+
+    XML_GET_INT(tree, MSG_STR_SUBSCRIPTIONID, message->body.unsubscribe.subscriptionId);
+
+ret:
+    return status;
+}
+
+static int xml_parse_body_unsubscribe_resp(ep_message_t *message, mxml_node_t *tree)
+{
+    int status = FA_OK;
+    mxml_node_t *node = NULL;
+
+    XML_GET_NODE(tree, tree, MSG_STR_UNSUBSCRIBE_RESP, node);
+
+    XML_GET_INT(tree, MSG_STR_STATUS, message->body.unsubscribeResponse.status);
+
+ret:
+    return status;
+}
+
+static int xml_parse_body_notify(ep_message_t *message, mxml_node_t *tree,
+                                 mmx_path_dict_t *dict)
+{
+    int status = FA_OK;
+    int i = 0;
+    long int arraySize;
+    const char *arraySizeStr;
+    char *s;
+
+    mxml_node_t *node = NULL, *subnode = NULL, *namenode = NULL;
+
+    if(!message->mem_pool.initialized)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS,
+                           "Message struct memory pool is not initialized for notify");
+
+    XML_GET_NODE(tree, tree, MSG_STR_NOTIFY, node);
+    XML_GET_INT(tree, MSG_STR_SUBSCRIPTIONID, message->body.notify.subscriptionId);
+    XML_GET_NODE(node, tree, MSG_STR_PARAMVALUES, node);
+
+    arraySizeStr = mxmlElementGetAttrValue(node, MSG_STR_ATTR_ARRAYSIZE);
+    if (arraySizeStr == NULL)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Attribute `%s' in not set",
+                                                        MSG_STR_ATTR_ARRAYSIZE);
+
+    arraySize = strtol(arraySizeStr, NULL, 10);
+    if (arraySize < 0 || arraySize > MAX_NUMBER_OF_RESPONSE_VALUES)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT,
+        "Incorrect value of attribute %s - %ld (max value is %d)",
+            MSG_STR_ATTR_ARRAYSIZE, arraySize, MAX_NUMBER_OF_RESPONSE_VALUES);
+
+    message->body.notify.arraySize = arraySize;
+
+    for (node = mxmlFindElement(node, tree, MSG_STR_NAMEVALUEPAIR, NULL, NULL, MXML_DESCEND);
+         node != NULL && i < arraySize;
+         node = mxmlFindElement(node, tree, MSG_STR_NAMEVALUEPAIR, NULL, NULL, MXML_DESCEND), i++)
+    {
+        namenode = mxmlFindElement(node, tree, MSG_STR_NAME, NULL, NULL, MXML_DESCEND);
+        if (!namenode)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: pair name missing");
+
+        subnode = mxmlFindElement(node, tree, MSG_STR_VALUE, NULL, NULL, MXML_DESCEND);
+        if (!subnode)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: pair value missing");
+        s = (char *)mxmlGetOpaque(subnode);
+
+        if (mmx_frontapi_msg_struct_insert_value(message, &message->body.notify.paramValues[i],
+                                                 s ? s : "") != FA_OK)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Not enough space in the pool for value %d", i);
+
+        if (xml_get_name(namenode, message, dict, message->body.notify.paramValues[i].name,
+                         NVP_MAX_NAME_LEN) != FA_OK)
+            GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Incorrect syntax: bad parameter name");
+    }
+    if (i != arraySize)
+        GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Number of parameters does not match arraySize attribute");
+
+ret:
+    return status;
+}
+
+/*
+ * Reads the optional header tags of the protocol extensions. They are
+ * looked up in <hdr> only: a message without them is not walked through.
+ */
+static void xml_get_header_ext(mxml_node_t *tree, ep_msg_header_t *header)
+{
+    mxml_node_t *hdr = mxmlFindElement(tree, tree, MSG_STR_HEADER, NULL, NULL, MXML_DESCEND);
+    mxml_node_t *node;
+    const char *s;
+
+    header->pathDict = 0;
+    header->version = 0;
+    header->delta = MMX_DELTA_FULL;
+    header->fragment = 0;
+    if (hdr == NULL)
+        return;
+
+    if ((node = mxmlFindElement(hdr, hdr, MSG_STR_PATHDICT, NULL, NULL, MXML_DESCEND)) &&
+        (s = mxmlGetOpaque(node)))
+        header->pathDict = strtoul(s, NULL, 10);
+
+    if ((node = mxmlFindElement(hdr, hdr, MSG_STR_VERSION, NULL, NULL, MXML_DESCEND)) &&
+        (s = mxmlGetOpaque(node)))
+        header->version = strtoul(s, NULL, 10);
+
+    if ((node = mxmlFindElement(hdr, hdr, MSG_STR_DELTA, NULL, NULL, MXML_DESCEND)) &&
+        (s = mxmlGetOpaque(node)))
+        header->delta = atoi(s);
+
+    if ((node = mxmlFindElement(hdr, hdr, MSG_STR_FRAGMENT, NULL, NULL, MXML_DESCEND)) &&
+        (s = mxmlGetOpaque(node)))
+        header->fragment = strtoul(s, NULL, 10);
+}
+
 int mmx_frontapi_message_parse(const char *xmlmsg, ep_message_t *message)
+{
+    return mmx_frontapi_message_parse_ex(xmlmsg, message, NULL);
+}
+
+int mmx_frontapi_message_parse_ex(const char *xmlmsg, ep_message_t *message,
+                                  mmx_path_dict_t *dict)
 {
     int status = FA_OK;
     char buf[MSG_MAX_STR_LEN];
@@ -754,6 +1038,10 @@ int mmx_frontapi_message_parse(const char *xmlmsg, ep_message_t *message)
         XML_GET_INT(tree, MSG_STR_MOREFLAG, message->header.moreFlag);
     }
 
+    xml_get_header_ext(tree, &message->header);
+
+    mmx_path_dict_follow(dict, message->header.pathDict);
+
     XML_GET_TEXT(tree, tree, MSG_STR_TYPE, buf, sizeof(buf), FALSE);
     message->header.msgType = msgtype2num(buf);
     
@@ -764,13 +1052,13 @@ int mmx_frontapi_message_parse(const char *xmlmsg, ep_message_t *message)
     /* Handle body */
     switch (message->header.msgType)
     {
-    case MSGTYPE_GETVALUE: status = xml_parse_body_getvalue(message, tree); break;
-    case MSGTYPE_GETVALUE_RESP: status = xml_parse_body_getvalue_resp(message, tree); break;
-    case MSGTYPE_SETVALUE: status = xml_parse_body_setvalue(message, tree); break;
-    case MSGTYPE_SETVALUE_RESP: status = xml_parse_body_setvalue_resp(message, tree); break;
+    case MSGTYPE_GETVALUE: status = xml_parse_body_getvalue(message, tree, dict); break;
+    case MSGTYPE_GETVALUE_RESP: status = xml_parse_body_getvalue_resp(message, tree, dict); break;
+    case MSGTYPE_SETVALUE: status = xml_parse_body_setvalue(message, tree, dict); break;
+    case MSGTYPE_SETVALUE_RESP: status = xml_parse_body_setvalue_resp(message, tree, dict); break;
     case MSGTYPE_GETPARAMNAMES: status = xml_parse_body_getparamnames(message, tree); break;
-    case MSGTYPE_GETPARAMNAMES_RESP: status = xml_parse_body_getparamnames_resp(message, tree); break;
-    case MSGTYPE_ADDOBJECT: status = xml_parse_body_addobject(message, tree); break;
+    case MSGTYPE_GETPARAMNAMES_RESP: status = xml_parse_body_getparamnames_resp(message, tree, dict); break;
+    case MSGTYPE_ADDOBJECT: status = xml_parse_body_addobject(message, tree, dict); break;
     case MSGTYPE_ADDOBJECT_RESP: status = xml_parse_body_addobject_resp(message, tree); break;
     case MSGTYPE_DELOBJECT: status = xml_parse_body_delobject(message, tree); break;
     case MSGTYPE_DELOBJECT_RESP: status = xml_parse_body_delobject_resp(message, tree); break;
@@ -779,10 +1067,16 @@ int mmx_frontapi_message_parse(const char *xmlmsg, ep_message_t *message)
     case MSGTYPE_REBOOT: status = xml_parse_body_reboot(message, tree); break;
     case MSGTYPE_RESET: status = xml_parse_body_reset(message, tree); break;
     case MSGTYPE_INITACTIONS: break;  // Currently this msg has no body node 
+    case MSGTYPE_SUBSCRIBE: status = xml_parse_body_subscribe(message, tree, dict); break;
+    case MSGTYPE_SUBSCRIBE_RESP: status = xml_parse_body_subscribe_resp(message, tree); break;
+    case MSGTYPE_UNSUBSCRIBE: status = xml_parse_body_unsubscribe(message, tree); break;
+    case MSGTYPE_UNSUBSCRIBE_RESP: status = xml_parse_body_unsubscribe_resp(message, tree); break;
+    case MSGTYPE_NOTIFY: status = xml_parse_body_notify(message, tree, dict); break;
     default: GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Unknown message type `%s'", buf);
     }
 
 ret:
+    MMX_TRACE_HDR(parse, MMX_TRACE_PARSE, &message->header, msg_body_items(message), status);
     mxmlDelete(tree);
     return status;
 }
@@ -816,6 +1110,8 @@ int mmx_frontapi_msg_header_parse(const char *xmlmsg, ep_msg_header_t *msg_heade
         XML_GET_INT(tree, MSG_STR_MOREFLAG, msg_header->moreFlag);
     }
 
+    xml_get_header_ext(tree, msg_header);
+
     XML_GET_TEXT(tree, tree, MSG_STR_TYPE, buf, sizeof(buf), FALSE);
     msg_header->msgType = msgtype2num(buf);
     
@@ -823,11 +1119,13 @@ int mmx_frontapi_msg_header_parse(const char *xmlmsg, ep_msg_header_t *msg_heade
     msg_header->mmxDbType = mmxdbtype_str2num(buf);
 
 ret:
+    MMX_TRACE_HDR(header_parse, MMX_TRACE_HEADER_PARSE, msg_header, 0, status);
     mxmlDelete(tree);
     return status;
 }
 
-static int xml_write_body_getvalue(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+static int xml_write_body_getvalue(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node,
+                                   const mmx_path_dict_t *dict)
 {
     char buf[MMXFA_MAX_NUMBER_OF_ANY_OP_PARAMS];
     int i;
@@ -846,15 +1144,13 @@ static int xml_write_body_getvalue(ep_message_t *message, mxml_node_t *tree, mxm
     mxmlElementSetAttr(node, MSG_STR_ATTR_ARRAYSIZE, buf);
 
     for (i = 0; i < message->body.getParamValue.arraySize; i++)
-    {
-        subnode = mxmlNewElement(node, MSG_STR_NAME);
-        mxmlNewText(subnode, 0, message->body.getParamValue.paramNames[i]);
-    }
+        xml_new_name(node, message->body.getParamValue.paramNames[i], dict);
 
     return FA_OK;
 }
 
-static int xml_write_body_setvalue(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+static int xml_write_body_setvalue(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node,
+                                   const mmx_path_dict_t *dict)
 {
     int status = FA_OK;
     char buf[MMXFA_MAX_NUMBER_OF_MSG_STR_SETTYPE];
@@ -880,9 +1176,7 @@ static int xml_write_body_setvalue(ep_message_t *message, mxml_node_t *tree, mxm
     for (i = 0; i < message->body.setParamValue.arraySize; i++)
     {
         subnode1 = mxmlNewElement(subnode, MSG_STR_NAMEVALUEPAIR);
-        subnode2 = mxmlNewElement(subnode1, MSG_STR_NAME);
-        
-        mxmlNewText(subnode2, 0, message->body.setParamValue.paramValues[i].name);
+        xml_new_name(subnode1, message->body.setParamValue.paramValues[i].name, dict);
         subnode2 = mxmlNewElement(subnode1, MSG_STR_VALUE);
         mxmlNewText(subnode2, 0, message->body.setParamValue.paramValues[i].pValue);
     }
@@ -890,7 +1184,8 @@ ret:
     return status;
 }
 
-static int xml_write_body_getvalue_resp(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+static int xml_write_body_getvalue_resp(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node,
+                                        const mmx_path_dict_t *dict)
 {
     int status = FA_OK;
     char buf[MMXFA_MAX_NUMBER_OF_ANY_OP_PARAMS];
@@ -909,8 +1204,7 @@ static int xml_write_body_getvalue_resp(ep_message_t *message, mxml_node_t *tree
     for (i = 0; i < message->body.getParamValueResponse.arraySize; i++)
     {
         subnode1 = mxmlNewElement(node, MSG_STR_NAMEVALUEPAIR);
-        subnode2 = mxmlNewElement(subnode1, MSG_STR_NAME);
-        mxmlNewText(subnode2, 0, message->body.getParamValueResponse.paramValues[i].name);
+        xml_new_name(subnode1, message->body.getParamValueResponse.paramValues[i].name, dict);
         subnode2 = mxmlNewElement(subnode1, MSG_STR_VALUE);
         mxmlNewText(subnode2, 0, message->body.getParamValueResponse.paramValues[i].pValue);
     }
@@ -919,7 +1213,8 @@ ret:
     return status;
 }
 
-static int xml_write_body_setvalue_resp(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+static int xml_write_body_setvalue_resp(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node,
+                                        const mmx_path_dict_t *dict)
 {
     char buf[MMXFA_MAX_NUMBER_OF_MMX_API_RC];
     int i;
@@ -953,8 +1248,7 @@ static int xml_write_body_setvalue_resp(ep_message_t *message, mxml_node_t *tree
                     message->body.setParamValueFaultResponse.paramFaults[i].name,
                     message->body.setParamValueFaultResponse.paramFaults[i].faultcode);
             subnode1 = mxmlNewElement(node, MSG_STR_PARAMFAULT);
-            subnode2 = mxmlNewElement(subnode1, MSG_STR_NAME );
-            mxmlNewText(subnode2, 0, message->body.setParamValueFaultResponse.paramFaults[i].name);
+            xml_new_name(subnode1, message->body.setParamValueFaultResponse.paramFaults[i].name, dict);
             subnode2 = mxmlNewElement(subnode1, MSG_STR_FAULTCODE);
             mxmlNewInteger(subnode2, message->body.setParamValueFaultResponse.paramFaults[i].faultcode);		    
         }
@@ -976,10 +1270,14 @@ static int xml_write_body_getparamnames(ep_message_t *message, mxml_node_t *tree
     return FA_OK;
 }
 
-static int xml_write_body_getparamnames_resp(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+static int xml_write_body_getparamnames_resp(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node,
+                                             mmx_path_dict_t *dict)
 {
     char buf[MMXFA_MAX_NUMBER_OF_ANY_OP_PARAMS];
     int i;
+    size_t len;
+    uint16_t id;
+    const char *name;
     mxml_node_t *subnode1, *subnode2;
 
     node = mxmlNewElement(node, MSG_STR_GETPARAMNAMES_RESP);
@@ -991,7 +1289,18 @@ static int xml_write_body_getparamnames_resp(ep_message_t *message, mxml_node_t
     {
         subnode1 = mxmlNewElement(node, MSG_STR_PARAMINFO);
         subnode2 = mxmlNewElement(subnode1, MSG_STR_NAME);
-        mxmlNewText(subnode2, 0, message->body.getParamNamesResponse.paramInfo[i].name);
+        name = message->body.getParamNamesResponse.paramInfo[i].name;
+        mxmlNewText(subnode2, 0, name);
+
+        /* Entry-point assigns dictionary Ids to object paths */
+        len = strlen(name);
+        if (dict != NULL && dict->role == MMX_PATHDICT_ROLE_EP && dict->generation != 0 &&
+            len >= MMX_PATHDICT_MIN_PREFIX_LEN && name[len - 1] == '.' &&
+            (id = mmx_path_dict_add(dict, name, len, 0)) != 0)
+        {
+            sprintf(buf, "%u", id);
+            mxmlElementSetAttr(subnode2, MSG_STR_ATTR_PATHDEF, buf);
+        }
         subnode2 = mxmlNewElement(subnode1, MSG_STR_WRITABLE);
         mxmlNewText(subnode2, 0, bool2str(message->body.getParamNamesResponse.paramInfo[i].writable));
     }
@@ -999,7 +1308,8 @@ static int xml_write_body_getparamnames_resp(ep_message_t *message, mxml_node_t
     return FA_OK;
 }
 
-static int xml_write_body_addobject(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+static int xml_write_body_addobject(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node,
+                                    const mmx_path_dict_t *dict)
 {
     int status = FA_OK;
     char buf[MMXFA_MAX_NUMBER_OF_ANY_OP_PARAMS];
@@ -1022,8 +1332,7 @@ static int xml_write_body_addobject(ep_message_t *message, mxml_node_t *tree, mx
     for (i = 0; i < message->body.addObject.arraySize; i++)
     {
         subnode2 = mxmlNewElement(subnode1, MSG_STR_NAMEVALUEPAIR);
-        subnode3 = mxmlNewElement(subnode2, MSG_STR_NAME);
-        mxmlNewText(subnode3, 0, message->body.addObject.paramValues[i].name);
+        xml_new_name(subnode2, message->body.addObject.paramValues[i].name, dict);
         subnode3 = mxmlNewElement(subnode2, MSG_STR_VALUE);
         mxmlNewText(subnode3, 0, message->body.addObject.paramValues[i].pValue);
     }
@@ -1126,10 +1435,116 @@ static int xml_write_body_reset(ep_message_t *message, mxml_node_t *tree, mxml_n
     return FA_OK;
 }
 
-int mmx_frontapi_message_build(ep_message_t *message, char *resp, size_t resp_size)
+static int xml_write_body_subscribe(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node,
+                                    const mmx_path_dict_t *dict)
+{
+    char buf[MMXFA_MAX_NUMBER_OF_ANY_OP_PARAMS];
+    int i;
+    mxml_node_t *subnode;
+
+    node = mxmlNewElement(node, MSG_STR_SUBSCRIBE);
+
+    subnode = mxmlNewElement(node, MSG_STR_MININTERVAL);
+    sprintf(buf, "%u", message->body.subscribe.minInterval);
+    mxmlNewText(subnode, 0, buf);
+
+    node = mxmlNewElement(node, MSG_STR_PARAMNAMES);
+    sprintf(buf, "%u", message->body.subscribe.arraySize);
+    mxmlElementSetAttr(node, MSG_STR_ATTR_ARRAYSIZE, buf);
+
+    for (i = 0; i < message->body.subscribe.arraySize; i++)
+        xml_new_name(node, message->body.subscribe.paramNames[i], dict);
+
+    return FA_OK;
+}
+
+static int xml_write_body_subscribe_resp(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+{
+    char buf[MMXFA_MAX_NUMBER_OF_MMX_API_RC];
+    mxml_node_t *subnode;
+
+    node = mxmlNewElement(node, MSG_STR_SUBSCRIBE_RESP);
+
+    subnode = mxmlNewElement(node, MSG_STR_SUBSCRIPTIONID);
+    sprintf(buf, "%u", message->body.subscribeResponse.subscriptionId);
+    mxmlNewText(subnode, 0, buf);
+
+    subnode = mxmlNewElement(node, MSG_STR_STATUS);
+    sprintf(buf, "%u", message->body.subscribeResponse.status);
+    mxmlNewText(subnode, 0, buf);
+
+    return FA_OK;
+}
+
+static int xml_write_body_unsubscribe(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+{
+    char buf[MMXFA_MAX_NUMBER_OF_MMX_API_RC];
+
+    node = mxmlNewElement(node, MSG_STR_UNSUBSCRIBE);
+    node = mxmlNewElement(node, MSG_STR_SUBSCRIPTIONID);
+    sprintf(buf, "%u", message->body.unsubscribe.subscriptionId);
+    mxmlNewText(node, 0, buf);
+
+    return FA_OK;
+}
+
+static int xml_write_body_unsubscribe_resp(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node)
+{
+    char buf[MMXFA_MAX_NUMBER_OF_MMX_API_RC];
+
+    node = mxmlNewElement(node, MSG_STR_UNSUBSCRIBE_RESP);
+    node = mxmlNewElement(node, MSG_STR_STATUS);
+    sprintf(buf, "%u", message->body.unsubscribeResponse.status);
+    mxmlNewText(node, 0, buf);
+
+    return FA_OK;
+}
+
+static int xml_write_body_notify(ep_message_t *message, mxml_node_t *tree, mxml_node_t *node,
+                                 const mmx_path_dict_t *dict)
 {
     int status = FA_OK;
+    char buf[MMXFA_MAX_NUMBER_OF_ANY_OP_PARAMS];
+    int i;
+    mxml_node_t *subnode1, *subnode2;
+
+    if(!message->mem_pool.initialized)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS,
+            "Message struct memory pool is not initialized for notify");
+
+    node = mxmlNewElement(node, MSG_STR_NOTIFY);
+
+    subnode1 = mxmlNewElement(node, MSG_STR_SUBSCRIPTIONID);
+    sprintf(buf, "%u", message->body.notify.subscriptionId);
+    mxmlNewText(subnode1, 0, buf);
+
+    node = mxmlNewElement(node, MSG_STR_PARAMVALUES);
+    sprintf(buf, "%u", message->body.notify.arraySize);
+    mxmlElementSetAttr(node, MSG_STR_ATTR_ARRAYSIZE, buf);
+
+    for (i = 0; i < message->body.notify.arraySize; i++)
+    {
+        subnode1 = mxmlNewElement(node, MSG_STR_NAMEVALUEPAIR);
+        xml_new_name(subnode1, message->body.notify.paramValues[i].name, dict);
+        subnode2 = mxmlNewElement(subnode1, MSG_STR_VALUE);
+        mxmlNewText(subnode2, 0, message->body.notify.paramValues[i].pValue);
+    }
+
+ret:
+    return status;
+}
+
+int mmx_frontapi_message_build(ep_message_t *message, char *resp, size_t resp_size)
+{
+    return mmx_frontapi_message_build_ex(message, resp, resp_size, NULL);
+}
+
+int mmx_frontapi_message_build_ex(ep_message_t *message, char *resp, size_t resp_size,
+                                  mmx_path_dict_t *dict)
+{
+    int status = FA_OK, len = 0;
     char buf[MSG_MAX_STR_LEN];
+    const mmx_path_dict_t *names_dict = dict;
 
     mxml_node_t *tree, *node;
 
@@ -1137,6 +1552,14 @@ int mmx_frontapi_message_build(ep_message_t *message, char *resp, size_t resp_si
     if (!tree)
         GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Could not load reply template");
 
+    /*
+     * Entry-point encodes names only for the client knowing its generation
+     * (header.pathDict of the request is kept in the response)
+     */
+    if (dict != NULL && dict->role == MMX_PATHDICT_ROLE_EP &&
+        message->header.pathDict != dict->generation)
+        names_dict = NULL;
+
     /* Fill in the header */
     XML_GET_NODE(tree, tree, MSG_STR_HEADER, node);
     XML_WRITE_INT(node, tree, MSG_STR_CALLERID, message->header.callerId);
@@ -1151,17 +1574,48 @@ int mmx_frontapi_message_build(ep_message_t *message, char *resp, size_t resp_si
     XML_WRITE_TEXT(node, tree, MSG_STR_TYPE, msgtype2str(message->header.msgType));
     XML_WRITE_TEXT(node, tree, MSG_STR_DBTYPE, mmxdbtype_num2str(message->header.mmxDbType));
 
+    if (dict != NULL)
+    {
+        XML_GET_NODE(tree, tree, MSG_STR_HEADER, node);
+        node = mxmlNewElement(node, MSG_STR_PATHDICT);
+        sprintf(buf, "%u", dict->generation);
+        mxmlNewText(node, 0, buf);
+    }
+
+    /* Tags of delta GetParamValue are written only if used */
+    if (message->header.version != 0)
+    {
+        XML_GET_NODE(tree, tree, MSG_STR_HEADER, node);
+        node = mxmlNewElement(node, MSG_STR_VERSION);
+        sprintf(buf, "%u", message->header.version);
+        mxmlNewText(node, 0, buf);
+    }
+    if (message->header.delta != MMX_DELTA_FULL)
+    {
+        XML_GET_NODE(tree, tree, MSG_STR_HEADER, node);
+        node = mxmlNewElement(node, MSG_STR_DELTA);
+        sprintf(buf, "%d", (int)message->header.delta);
+        mxmlNewText(node, 0, buf);
+    }
+    if (message->header.fragment != 0)
+    {
+        XML_GET_NODE(tree, tree, MSG_STR_HEADER, node);
+        node = mxmlNewElement(node, MSG_STR_FRAGMENT);
+        sprintf(buf, "%u", (unsigned)message->header.fragment);
+        mxmlNewText(node, 0, buf);
+    }
+
     /* Fill in the body */
     XML_GET_NODE(tree, tree, MSG_STR_BODY, node);
     switch (message->header.msgType)
     {
-    case MSGTYPE_GETVALUE: status = xml_write_body_getvalue(message, tree, node); break;
-    case MSGTYPE_GETVALUE_RESP: status = xml_write_body_getvalue_resp(message, tree, node); break;
-    case MSGTYPE_SETVALUE: status = xml_write_body_setvalue(message, tree, node); break;
-    case MSGTYPE_SETVALUE_RESP: status = xml_write_body_setvalue_resp(message, tree, node); break;
+    case MSGTYPE_GETVALUE: status = xml_write_body_getvalue(message, tree, node, names_dict); break;
+    case MSGTYPE_GETVALUE_RESP: status = xml_write_body_getvalue_resp(message, tree, node, names_dict); break;
+    case MSGTYPE_SETVALUE: status = xml_write_body_setvalue(message, tree, node, names_dict); break;
+    case MSGTYPE_SETVALUE_RESP: status = xml_write_body_setvalue_resp(message, tree, node, names_dict); break;
     case MSGTYPE_GETPARAMNAMES: status = xml_write_body_getparamnames(message, tree, node); break;
-    case MSGTYPE_GETPARAMNAMES_RESP: status = xml_write_body_getparamnames_resp(message, tree, node); break;
-    case MSGTYPE_ADDOBJECT: status = xml_write_body_addobject(message, tree, node); break;
+    case MSGTYPE_GETPARAMNAMES_RESP: status = xml_write_body_getparamnames_resp(message, tree, node, dict); break;
+    case MSGTYPE_ADDOBJECT: status = xml_write_body_addobject(message, tree, node, names_dict); break;
     case MSGTYPE_ADDOBJECT_RESP: status = xml_write_body_addobject_resp(message, tree, node); break;
     case MSGTYPE_DELOBJECT: status = xml_write_body_delobject(message, tree, node); break;
     case MSGTYPE_DELOBJECT_RESP: status = xml_write_body_delobject_resp(message, tree, node); break;
@@ -1169,16 +1623,22 @@ int mmx_frontapi_message_build(ep_message_t *message, char *resp, size_t resp_si
     case MSGTYPE_DISCOVERCONFIG_RESP: status = FA_OK; break;  // Currently this msg has no body node 
     case MSGTYPE_REBOOT: status = xml_write_body_reboot(message, tree, node); break;
     case MSGTYPE_RESET: status = xml_write_body_reset(message, tree, node); break;
+    case MSGTYPE_SUBSCRIBE: status = xml_write_body_subscribe(message, tree, node, names_dict); break;
+    case MSGTYPE_SUBSCRIBE_RESP: status = xml_write_body_subscribe_resp(message, tree, node); break;
+    case MSGTYPE_UNSUBSCRIBE: status = xml_write_body_unsubscribe(message, tree, node); break;
+    case MSGTYPE_UNSUBSCRIBE_RESP: status = xml_write_body_unsubscribe_resp(message, tree, node); break;
+    case MSGTYPE_NOTIFY: status = xml_write_body_notify(message, tree, node, names_dict); break;
     default: GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Unknown message type `%d'", message->header.msgType);
     }
 
     if (status != FA_OK)
         GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Could not write message body");
 
-    if (mxmlSaveString(tree, resp, resp_size, MXML_NO_CALLBACK) <= 0)
+    if ((len = mxmlSaveString(tree, resp, resp_size, MXML_NO_CALLBACK)) <= 0)
         GOTO_RET_WITH_ERROR(FA_INVALID_FORMAT, "Could not save message to string");
 
 ret:
+    MMX_TRACE_HDR(build, MMX_TRACE_BUILD, &message->header, (size_t)(len > 0 ? len : 0), status);
     mxmlDelete(tree);
     return status;
 }
@@ -1186,7 +1646,7 @@ ret:
 
 int mmx_frontapi_connect(mmx_ep_connection_t *conn, in_port_t own_port, unsigned timeout)
 {
-    conn->sock = 0;
+    memset(conn, 0, sizeof(*conn));
 
     if (udp_socket_init(&(conn->sock), MMX_EP_ADDR, own_port))
     {
@@ -1215,13 +1675,30 @@ int mmx_frontapi_connect(mmx_ep_connection_t *conn, in_port_t own_port, unsigned
 
 int mmx_frontapi_send_req(mmx_ep_connection_t *conn, ep_packet_t *pkt)
 {
-    int res = sendto(conn->sock, pkt, sizeof(ep_packet_t)+strlen(pkt->msg)+1,
+    return mmx_send_packet(conn, pkt, NULL);
+}
+
+int mmx_send_packet(mmx_ep_connection_t *conn, ep_packet_t *pkt, const ep_msg_header_t *hdr)
+{
+    static const ep_msg_header_t no_hdr;
+    int res;
+
+    if (hdr == NULL)
+        hdr = &no_hdr;
+
+    res = sendto(conn->sock, pkt, sizeof(ep_packet_t)+strlen(pkt->msg)+1,
                          0, (struct sockaddr *)&conn->dest, sizeof(conn->dest));
     if (res < 0)
     {
         perror("Could not send packet to Entry point");
+        MMX_STATS_COUNT(conn->stats, send_errors, 1);
+        MMX_TRACE_HDR(send, MMX_TRACE_SEND, hdr, 0, 1);
         return 1;
     }
+    MMX_STATS_COUNT(conn->stats, packets_sent, 1);
+    MMX_STATS_COUNT(conn->stats, bytes_sent, res);
+    MMX_CAPTURE(conn, MMX_CAPTURE_DIR_SENT, hdr->txaId, pkt, res);
+    MMX_TRACE_HDR(send, MMX_TRACE_SEND, hdr, (size_t)res, 0);
     return 0;
 }
 
@@ -1235,13 +1712,15 @@ int mmx_frontapi_receive(mmx_ep_connection_t *conn, char *buf, size_t buf_size,
     }
     buf[res] = '\0';
     *rcvd = res;
+    MMX_CAPTURE(conn, MMX_CAPTURE_DIR_RECEIVED, 0, buf, res);
     return 0;
 }
 
 int mmx_frontapi_receive_resp(mmx_ep_connection_t *conn, int txaId,
                               char *buf, size_t buf_size, size_t *rcvd)
 {
-    int res = 0, still_waiting = 1;
+    int res = 0, still_waiting = 1, hdr_stat;
+    size_t discarded = 0;
     ep_msg_header_t msg_header;
     struct timeval begin, now;
     double timediff;
@@ -1256,17 +1735,39 @@ int mmx_frontapi_receive_resp(mmx_ep_connection_t *conn, int txaId,
 
         if((res = recv(conn->sock, buf, buf_size, 0)) > 0)
         {
+            MMX_STATS_COUNT(conn->stats, packets_received, 1);
+            MMX_STATS_COUNT(conn->stats, bytes_received, res);
+
             /* Check transaction Id in the received packet */              
-            if (mmx_frontapi_msg_header_parse(buf, &msg_header) == 0)
+            hdr_stat = mmx_frontapi_msg_header_parse(buf, &msg_header);
+            MMX_TRACE_HDR(receive, MMX_TRACE_RECEIVE, &msg_header, (size_t)res, hdr_stat);
+            MMX_CAPTURE(conn, MMX_CAPTURE_DIR_RECEIVED, msg_header.txaId, buf, res);
+            if (hdr_stat == 0)
             {
-                if (msg_header.txaId == txaId)
+                /* Notification is not the response even if it has the same txaId */
+                if (msg_header.txaId == txaId && msg_header.msgType != MSGTYPE_NOTIFY)
                 {
                     /* It's correct response */
                     buf[res] = '\0';
                     *rcvd = res;
+                    MMX_TRACE_HDR(fragment, MMX_TRACE_FRAGMENT, &msg_header, (size_t)res,
+                                  (int)msg_header.moreFlag);
                     return 0;
                 }
             }
+
+            /* Notification that arrived while waiting for the response */
+            if (hdr_stat == 0 && msg_header.msgType == MSGTYPE_NOTIFY && conn->notify)
+            {
+                buf[res] = '\0';
+                mmx_notify_input(conn, buf);
+            }
+            else
+            {
+                MMX_STATS_COUNT(conn->stats, discarded, 1);
+                MMX_TRACE_HDR(discard, MMX_TRACE_DISCARD, &msg_header, (size_t)res, hdr_stat);
+                discarded++;
+            }
         }
 
         gettimeofday(&now , NULL);
@@ -1278,6 +1779,8 @@ int mmx_frontapi_receive_resp(mmx_ep_connection_t *conn, int txaId,
         }
     }
 
+    MMX_STATS_COUNT(conn->stats, timeouts, 1);
+    MMX_TRACE(timeout, MMX_TRACE_TIMEOUT, txaId, 0, 0, discarded, 1);
     return 1;
 }
 
@@ -1294,27 +1797,38 @@ int mmx_frontapi_make_request(mmx_ep_connection_t *conn, ep_message_t *msg, int
     size_t rcvd = 0;
     char buf[FA_BUF_SIZE];
     ep_packet_t *packet = (ep_packet_t *)buf;
+    msgtype_t type = msg->header.msgType;
+    uint64_t start, t;
+
+    start = t = mmx_stats_start(conn->stats);
 
     memset(packet->flags, 0, sizeof(packet->flags));
     if (more)
         *more = 0;
 
-    if  (stat = mmx_frontapi_message_build(msg, packet->msg, (sizeof(buf) - sizeof(packet->flags) - 1)) != 0)
-        return stat;
+    if ((stat = mmx_frontapi_message_build_ex(msg, packet->msg, (sizeof(buf) - sizeof(packet->flags) - 1),
+                                              conn->path_dict)) != 0)
+        goto ret;
+    t = mmx_stats_lap(conn->stats, MMX_STATS_PHASE_BUILD, t);
 
-    if ((stat = mmx_frontapi_send_req(conn, packet)) != 0)
-        return stat;
+    if ((stat = mmx_send_packet(conn, packet, &msg->header)) != 0)
+        goto ret;
+    t = mmx_stats_lap(conn->stats, MMX_STATS_PHASE_SEND, t);
 
-    if ((stat = mmx_frontapi_receive_resp(conn, msg->header.txaId, buf, sizeof(buf), &rcvd)) != 0)
-        return stat;
+    if ((stat = mmx_frontapi_receive_resp(conn, msg->header.txaId, buf, sizeof(buf) - 1, &rcvd)) != 0)
+        goto ret;
+    t = mmx_stats_lap(conn->stats, MMX_STATS_PHASE_WAIT, t);
 
-    if ((stat = mmx_frontapi_message_parse(buf, msg)) != 0)
-        return stat;
+    if ((stat = mmx_frontapi_message_parse_ex(buf, msg, conn->path_dict)) != 0)
+        goto ret;
+    mmx_stats_lap(conn->stats, MMX_STATS_PHASE_PARSE, t);
 
     if (more)
         *more = msg->header.moreFlag;
 
-    return FA_OK;
+ret:
+    mmx_stats_done(conn->stats, type, stat, start);
+    return stat;
 }
 
 int mmx_frontapi_make_xml_request(mmx_ep_connection_t *conn, char *xml_str,
@@ -1326,6 +1840,10 @@ int mmx_frontapi_make_xml_request(mmx_ep_connection_t *conn, char *xml_str,
     size_t rcvd = 0;
     ep_packet_t *packet = (ep_packet_t *)buf;
     ep_msg_header_t msg_header = {0};
+    msgtype_t type = MSGTYPE_ERR;
+    uint64_t start, t;
+
+    start = t = mmx_stats_start(conn->stats);
 
     memset(packet->flags, 0, sizeof(packet->flags));
     strcpy_safe(packet->msg, xml_str, sizeof(buf) - sizeof(packet->flags) - 1);
@@ -1333,26 +1851,33 @@ int mmx_frontapi_make_xml_request(mmx_ep_connection_t *conn, char *xml_str,
         *more = 0;
 
     if ((stat = mmx_frontapi_msg_header_parse(xml_str, &msg_header)) != 0)
-        return stat;
+        goto ret;
 
     txaId = msg_header.txaId;
+    type = msg_header.msgType;
+    t = mmx_stats_lap(conn->stats, MMX_STATS_PHASE_BUILD, t);
 
-    if ((stat = mmx_frontapi_send_req(conn, packet)) != 0)
-        return stat;
+    if ((stat = mmx_send_packet(conn, packet, &msg_header)) != 0)
+        goto ret;
+    t = mmx_stats_lap(conn->stats, MMX_STATS_PHASE_SEND, t);
    
-    if ((stat = mmx_frontapi_receive_resp(conn, txaId, xml_str, xml_str_size, &rcvd)) != 0)
-        return stat;
+    if ((stat = mmx_frontapi_receive_resp(conn, txaId, xml_str, xml_str_size - 1, &rcvd)) != 0)
+        goto ret;
+    t = mmx_stats_lap(conn->stats, MMX_STATS_PHASE_WAIT, t);
 
     if (more)
     {
         memset(&msg_header, 0, sizeof(msg_header));
         if ((stat = mmx_frontapi_msg_header_parse(xml_str, &msg_header)) != 0)
-             return stat;
+             goto ret;
+        mmx_stats_lap(conn->stats, MMX_STATS_PHASE_PARSE, t);
 
         *more = msg_header.moreFlag;
     }
 
-    return FA_OK;
+ret:
+    mmx_stats_done(conn->stats, type, stat, start);
+    return stat;
 }
 
 
@@ -1369,6 +1894,7 @@ int mmx_frontapi_msg_struct_init (ep_message_t *message, char *mem_buff,
     if (message == NULL || mem_buff == NULL || mem_buff_size <= 16)
         GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
 
+    memset(&message->header, 0, sizeof(message->header));
     memset(mem_buff, 0, mem_buff_size);
 
     message->mem_pool.pool = mem_buff;
@@ -1381,6 +1907,26 @@ int mmx_frontapi_msg_struct_init (ep_message_t *message, char *mem_buff,
     return status;
 }
 
+/*
+ *  Prepares the initialized message structure for reuse: the header is
+ *  cleared and only the used part of the memory pool is zeroed (the rest
+ *  of it is still zero since mmx_frontapi_msg_struct_init)
+ */
+int mmx_frontapi_msg_struct_reset(ep_message_t *message)
+{
+    int status = 0;
+
+    if (message == NULL || !message->mem_pool.initialized)
+        GOTO_RET_WITH_ERROR(FA_BAD_INPUT_PARAMS, "Bad input parameters");
+
+    memset(&message->header, 0, sizeof(message->header));
+    memset(message->mem_pool.pool, 0, message->mem_pool.curr_offset);
+    message->mem_pool.curr_offset = 0;
+
+    ret:
+    return status;
+}
+
 /*
 * Release front-api message structure (ep_message_t).
 * All fields of the message memory pool are initialized.
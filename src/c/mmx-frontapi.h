@@ -88,6 +88,9 @@
 #define MMX_EP_BE_ADDR    INADDR_ANY
 #define MMX_EP_PORT       10100
 
+/* Max size of a datagram sent by the Entry-point (fragment of a response) */
+#define MMXFA_MAX_DATAGRAM_SIZE  32768
+
 /* Error messages */
 #define FA_OK                  0
 #define FA_GENERAL_ERROR       1
@@ -142,6 +145,11 @@
 #define MMX_API_RESPMODE_NOSYNC  1   // Non-blocking call of EP API request
 #define MMX_API_RESPMODE_NORESP  2   // Response is not needed
 
+/* Delta flag of GetParamValue response to request with version (see mmx-frontapi-delta.h) */
+#define MMX_DELTA_FULL           0   // All requested values
+#define MMX_DELTA_CHANGES        1   // Only values changed since the version of the request
+#define MMX_DELTA_NOT_MODIFIED   2   // Nothing changed since the version, no values
+
 /* Reset type */
 #define MMX_API_RESETTYPE_FACTORY  0 // Full factory reset
 #define MMX_API_RESETTYPE_KEEPIP   1 // Factory reset keeping device IP connectivity info
@@ -201,6 +209,10 @@
 #define MSG_STR_DBTYPE      "dbType"
 #define MSG_STR_RESPCODE    "resCode"
 #define MSG_STR_MOREFLAG    "moreFlag"
+#define MSG_STR_PATHDICT    "pathDict"
+#define MSG_STR_VERSION     "version"
+#define MSG_STR_DELTA       "delta"
+#define MSG_STR_FRAGMENT    "fragment"
 
 /* Body */
 #define MSG_STR_BODY                "body"
@@ -219,6 +231,11 @@
 #define MSG_STR_INITACTIONS         "InitActions"
 #define MSG_STR_REBOOT              "Reboot"
 #define MSG_STR_RESET               "FactoryReset"
+#define MSG_STR_SUBSCRIBE           "Subscribe"
+#define MSG_STR_SUBSCRIBE_RESP      "SubscribeResponse"
+#define MSG_STR_UNSUBSCRIBE         "Unsubscribe"
+#define MSG_STR_UNSUBSCRIBE_RESP    "UnsubscribeResponse"
+#define MSG_STR_NOTIFY              "Notify"
 
 #define MSG_STR_BACKENDNAME         "backendName"
 
@@ -243,8 +260,12 @@
 #define MSG_STR_RESETTYPE       "resetType"
 #define MSG_STR_INST_NUMBER     "objInstanceNumber"
 #define MSG_STR_SETTYPE         "setType"
+#define MSG_STR_SUBSCRIPTIONID  "subscriptionId"
+#define MSG_STR_MININTERVAL     "minInterval"
 
 #define MSG_STR_ATTR_ARRAYSIZE  "arraySize"
+#define MSG_STR_ATTR_PATHDICT   "pd"      /* Id of the name prefix (see mmx-frontapi-pathdict.h) */
+#define MSG_STR_ATTR_PATHDEF    "pdDef"   /* Id assigned to the object path */
 
 typedef enum msgtype_e {
     MSGTYPE_ERR = -1,
@@ -263,6 +284,11 @@ typedef enum msgtype_e {
     MSGTYPE_INITACTIONS,
     MSGTYPE_REBOOT,
     MSGTYPE_RESET,
+    MSGTYPE_SUBSCRIBE,
+    MSGTYPE_SUBSCRIBE_RESP,
+    MSGTYPE_UNSUBSCRIBE,
+    MSGTYPE_UNSUBSCRIBE_RESP,
+    MSGTYPE_NOTIFY,         /* sent by the Entry-point, not a response */
 
     MSGTYPE_LAST
 } msgtype_t;
@@ -401,7 +427,46 @@ typedef struct ep_reset_req_s {
     uint32_t resetType;
 } ep_reset_req_t;
 
-/* Entry-point message header  */
+/*
+ * Subscription to value changes of parameters (names or object paths).
+ * The Entry-point sends Notify messages with the changed values to the
+ * response address of Subscribe request, at most one per minInterval ms
+ * (changes within the interval are sent together).
+ */
+typedef struct ep_subscribe_req_s {
+    uint32_t minInterval;
+    uint32_t arraySize;
+    char paramNames[MSG_MAX_NUMBER_OF_GET_PARAMS][NVP_MAX_NAME_LEN];
+} ep_subscribe_req_t;
+
+typedef struct ep_subscribe_resp_s {
+    uint32_t subscriptionId;
+    uint32_t status;
+} ep_subscribe_resp_t;
+
+typedef struct ep_unsubscribe_req_s {
+    uint32_t subscriptionId;
+} ep_unsubscribe_req_t;
+
+typedef struct ep_unsubscribe_resp_s {
+    uint32_t status;
+} ep_unsubscribe_resp_t;
+
+typedef struct ep_notify_s {
+    uint32_t subscriptionId;
+    uint32_t arraySize;
+    nvpair_t paramValues[MAX_NUMBER_OF_RESPONSE_VALUES];
+} ep_notify_t;
+
+/*
+ * Entry-point message header
+ * version, delta and fragment are written to the message only if they are
+ * not 0 (not MMX_DELTA_FULL), so the header must be cleared before it is
+ * filled in: by mmx_frontapi_msg_struct_init/mmx_frontapi_msg_struct_reset
+ * or e.g. ep_message_t msg = {0}. Otherwise a stale version turns a
+ * GetParamValue into a delta request and its response has only the changed
+ * values.
+ */
 typedef struct ep_msg_header_s {
     int callerId;
     int txaId;
@@ -413,6 +478,11 @@ typedef struct ep_msg_header_s {
     mmx_dbtype_t mmxDbType;
     int respCode;
     char moreFlag;
+    uint32_t pathDict;   /* Generation of the path dictionary, 0 - not used */
+    uint32_t version;    /* Version of the requested values (delta GetParamValue), 0 - not used */
+    char delta;          /* MMX_DELTA_* of GetParamValueResponse */
+    uint16_t fragment;   /* Index (from 1) of the fragment of GetParamValueResponse with
+                            version, 0 - not fragmented */
 } ep_msg_header_t;
 
 /* Entry-point message body */
@@ -438,6 +508,12 @@ typedef union ep_msg_body_s {
     ep_reboot_req_t reboot;
     ep_reset_req_t  reset;
 
+    ep_subscribe_req_t subscribe;
+    ep_subscribe_resp_t subscribeResponse;
+    ep_unsubscribe_req_t unsubscribe;
+    ep_unsubscribe_resp_t unsubscribeResponse;
+    ep_notify_t notify;
+
 } ep_msg_body_t;
 
 
@@ -456,13 +532,33 @@ typedef struct ep_message_s {
     ep_msg_mempool_t   mem_pool;
 } ep_message_t;
 
+/* Path dictionary (defined in mmx-frontapi-pathdict.h) */
+typedef struct mmx_path_dict_s mmx_path_dict_t;
+
+/* Connection statistics (defined in mmx-frontapi-stats.h) */
+typedef struct mmx_ep_stats_s mmx_ep_stats_t;
+
+/* Traffic capture (defined in mmx-frontapi-capture.h) */
+typedef struct mmx_capture_s mmx_capture_t;
+
+/* Delivery of Notify messages (defined in mmx-frontapi-notify.h) */
+typedef struct mmx_notify_s mmx_notify_t;
+
 /*
  * Entry-point connection structure
+ * Fields after sock_timeout were added in library version 1 (soname
+ * libmmx-frontapi.so.1): a caller that sets up the structure by itself
+ * instead of mmx_frontapi_connect must zero-initialise it, e.g.
+ * mmx_ep_connection_t conn = {0}, and must be rebuilt with this header.
  */
 typedef struct mmx_ep_connection_s {
     int sock;
     struct sockaddr_in dest;
     unsigned sock_timeout;
+    mmx_path_dict_t *path_dict;
+    mmx_ep_stats_t *stats;
+    mmx_capture_t *capture;
+    mmx_notify_t *notify;
 } mmx_ep_connection_t;
 
 /*
@@ -507,6 +603,18 @@ int mmx_frontapi_msg_header_parse(const char *xml_string, ep_msg_header_t *msg_h
  */
 int mmx_frontapi_message_build(ep_message_t *message, char *xml_string, size_t xml_string_size);
 
+/*
+ * The same as mmx_frontapi_message_parse/mmx_frontapi_message_build, but
+ * parameter names are decoded/encoded with the specified path dictionary
+ * (may be NULL). Entry-point builds the response with header.pathDict of
+ * the request (see mmx-frontapi-pathdict.h).
+ */
+int mmx_frontapi_message_parse_ex(const char *xml_string, ep_message_t *message,
+                                  mmx_path_dict_t *dict);
+
+int mmx_frontapi_message_build_ex(ep_message_t *message, char *xml_string,
+                                  size_t xml_string_size, mmx_path_dict_t *dict);
+
 
 /* ********************************************************************* */
 /*                            Shorthand API                              */
@@ -559,13 +667,19 @@ char *mmxdbtype_num2str(mmx_dbtype_t dbtype);
 /* ******************************************************************** */
 
 /*
- *  Initialize front-api message structure (ep_message_t)
- *  The caller must supply memory buffer that will be used for keeping
- *  parameters values
+ *  Initialize front-api message structure (ep_message_t), the header is
+ *  cleared. The caller must supply memory buffer that will be used for
+ *  keeping parameters values
  */
 int mmx_frontapi_msg_struct_init (ep_message_t *message, char *mem_buff,
                                   unsigned short mem_buff_size);
 
+/*
+ * Prepares the message structure for reuse: clears the header and the used
+ * part of the memory pool (cheaper than mmx_frontapi_msg_struct_init)
+ */
+int mmx_frontapi_msg_struct_reset (ep_message_t *message);
+
  /*
   * Release front-api message structure (ep_message_t)
   */
@@ -0,0 +1,629 @@
+/* mmx-frontapi-lua.c
+ *
+ * Copyright (c) 2013-2021 Inango Systems LTD.
+ *
+ * Author: Inango Systems LTD. <support@inango-systems.com>
+ * Creation Date: Oct 2026
+ *
+ * The author may be reached at support@inango-systems.com
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Subject to the terms and conditions of this license, each copyright holder
+ * and contributor hereby grants to those receiving rights under this license
+ * a perpetual, worldwide, non-exclusive, no-charge, royalty-free, irrevocable
+ * (except for failure to satisfy the conditions of this license) patent license
+ * to make, have made, use, offer to sell, sell, import, and otherwise transfer
+ * this software, where such license applies only to those patent claims, already
+ * acquired or hereafter acquired, licensable by such copyright holder or contributor
+ * that are necessarily infringed by:
+ *
+ * (a) their Contribution(s) (the licensed copyrights of copyright holders and
+ * non-copyrightable additions of contributors, in source or binary form) alone;
+ * or
+ *
+ * (b) combination of their Contribution(s) with the work of authorship to which
+ * such Contribution(s) was added by such copyright holder or contributor, if,
+ * at the time the Contribution is added, such addition causes such combination
+ * to be necessarily infringed. The patent license shall not apply to any other
+ * combinations which include the Contribution.
+ *
+ * Except as expressly stated above, no rights or licenses from any copyright
+ * holder or contributor is granted under this license, whether expressly, by
+ * implication, estoppel or otherwise.
+ *
+ * DISCLAIMER
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * NOTE
+ *
+ * This is part of a management middleware software package called MMX that was developed by Inango Systems Ltd.
+ *
+ * This version of MMX provides web and command-line management interfaces.
+ *
+ * Please contact us at Inango at support@inango-systems.com if you would like to hear more about
+ * - other management packages, such as SNMP, TR-069 or Netconf
+ * - how we can extend the data model to support all parts of your system
+ * - professional sub-contract and customization services
+ *
+ */
+
+/*
+ * Native Lua module "mmx_frontapi".
+ *
+ * Converts Lua request tables (see description in mmx-frontapi.lua) to
+ * Entry-point XML messages and parses Entry-point responses directly into
+ * Lua tables of the same shape as the LuaXml based code in mmx-frontapi.lua
+ * produces, so callers (e.g. MMXAPIWrapper) do not see any difference.
+ *
+ *   local fa = require "mmx_frontapi"
+ *   local xml_str = fa.build(request, respPort, respIpAddr)
+ *   local response, err = fa.parse(xml_str)
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include <lua.h>
+#include <lauxlib.h>
+
+#include <microxml.h>
+
+#include "mmx-frontapi.h"
+
+#define MMX_ERROR_INTERNAL_ERROR  9002
+
+#if LUA_VERSION_NUM >= 502
+#define lua_objlen(L, i)  lua_rawlen(L, (i))
+#endif
+
+/* ---------------------------------------------------------------
+ * Request builder
+ * --------------------------------------------------------------- */
+
+static void add_escaped(luaL_Buffer *b, const char *s, size_t len)
+{
+    size_t i, start = 0;
+    const char *ent;
+
+    for (i = 0; i < len; i++)
+    {
+        switch (s[i])
+        {
+        case '&':  ent = "&amp;";  break;
+        case '<':  ent = "&lt;";   break;
+        case '>':  ent = "&gt;";   break;
+        case '"':  ent = "&quot;"; break;
+        case '\'': ent = "&apos;"; break;
+        default:   continue;
+        }
+        luaL_addlstring(b, s + start, i - start);
+        luaL_addstring(b, ent);
+        start = i + 1;
+    }
+    luaL_addlstring(b, s + start, len - start);
+}
+
+static void add_open(luaL_Buffer *b, const char *tag)
+{
+    luaL_addchar(b, '<');
+    luaL_addstring(b, tag);
+    luaL_addchar(b, '>');
+}
+
+static void add_close(luaL_Buffer *b, const char *tag)
+{
+    luaL_addlstring(b, "</", 2);
+    luaL_addstring(b, tag);
+    luaL_addchar(b, '>');
+}
+
+/*
+ * Adds element with text of the value on the top of the Lua stack
+ * and pops the value. nil produces an empty element.
+ * Note: luaL_Buffer may use the stack, so the value is copied and popped
+ * before anything is added to the buffer.
+ */
+static void add_elem_top(lua_State *L, luaL_Buffer *b, const char *tag)
+{
+    char tmp[MSG_MAX_STR_LEN];
+    char *copy = tmp;
+    const char *s = NULL;
+    size_t len = 0;
+
+    switch (lua_type(L, -1))
+    {
+    case LUA_TSTRING:
+    case LUA_TNUMBER:
+        s = lua_tolstring(L, -1, &len);
+        break;
+    case LUA_TBOOLEAN:
+        s = lua_toboolean(L, -1) ? "true" : "false";
+        len = strlen(s);
+        break;
+    }
+
+    if (s != NULL && len > sizeof(tmp) && (copy = malloc(len)) == NULL)
+        s = NULL;
+    if (s != NULL)
+        memcpy(copy, s, len);
+    lua_pop(L, 1);
+
+    if (s == NULL)
+    {
+        luaL_addchar(b, '<');
+        luaL_addstring(b, tag);
+        luaL_addlstring(b, "/>", 2);
+        return;
+    }
+
+    add_open(b, tag);
+    add_escaped(b, copy, len);
+    add_close(b, tag);
+
+    if (copy != tmp)
+        free(copy);
+}
+
+/* Adds element with text of field 'key' of table at index 'tbl' */
+static void add_field(lua_State *L, luaL_Buffer *b, int tbl, const char *key, const char *tag)
+{
+    lua_getfield(L, tbl, key);
+    add_elem_top(L, b, tag ? tag : key);
+}
+
+/* Adds element "true"/"false" for field that is set (as the Lua builder does) */
+static void add_flag_field(lua_State *L, luaL_Buffer *b, int tbl, const char *key)
+{
+    int set;
+
+    lua_getfield(L, tbl, key);
+    if (!lua_toboolean(L, -1))
+    {
+        lua_pop(L, 1);
+        return;
+    }
+    set = (lua_type(L, -1) == LUA_TBOOLEAN);
+    lua_pop(L, 1);
+
+    add_open(b, key);
+    luaL_addstring(b, set ? "true" : "false");
+    add_close(b, key);
+}
+
+static void add_array_size(luaL_Buffer *b, const char *tag, size_t count)
+{
+    char tmp[MSG_MAX_STR_LEN];
+
+    snprintf(tmp, sizeof(tmp), "<%s " MSG_STR_ATTR_ARRAYSIZE "=\"%u\">", tag, (unsigned)count);
+    luaL_addstring(b, tmp);
+}
+
+/* Pushes body[key][i] (i > 0) or body[key][i][field] onto the stack */
+static void push_item(lua_State *L, int body, const char *key, size_t i, const char *field)
+{
+    lua_getfield(L, body, key);
+    if (lua_istable(L, -1))
+        lua_rawgeti(L, -1, i);
+    else
+        lua_pushnil(L);
+    if (field != NULL)
+    {
+        if (lua_istable(L, -1))
+            lua_getfield(L, -1, field);
+        else
+            lua_pushnil(L);
+        lua_remove(L, -2);
+    }
+    lua_remove(L, -2);
+}
+
+/*
+ * Adds list element (e.g. paramNames) with array of tables from field
+ * 'key' of the body; 'fields' are copied from every item to 'item_tag'
+ * element (or directly to the list if 'item_tag' is NULL).
+ * Values are fetched one by one, as the stack is shared with luaL_Buffer.
+ */
+static void add_list(lua_State *L, luaL_Buffer *b, int body, const char *key,
+                     const char *list_tag, const char *item_tag, const char **fields)
+{
+    size_t i, n = 0;
+    const char **f;
+    int is_table;
+
+    lua_getfield(L, body, key);
+    if (lua_istable(L, -1))
+        n = lua_objlen(L, -1);
+    lua_pop(L, 1);
+
+    add_array_size(b, list_tag, n);
+    for (i = 1; i <= n; i++)
+    {
+        push_item(L, body, key, i, NULL);
+        is_table = lua_istable(L, -1);
+        lua_pop(L, 1);
+        if (!is_table)
+            continue;
+
+        if (item_tag)
+            add_open(b, item_tag);
+        for (f = fields; *f; f++)
+        {
+            push_item(L, body, key, i, *f);
+            add_elem_top(L, b, *f);
+        }
+        if (item_tag)
+            add_close(b, item_tag);
+    }
+    add_close(b, list_tag);
+}
+
+static const char *name_fields[] = { MSG_STR_NAME, NULL };
+static const char *nvpair_fields[] = { MSG_STR_NAME, MSG_STR_VALUE, NULL };
+static const char *objname_fields[] = { MSG_STR_OBJNAME, NULL };
+static const char *copy_fields[] = {
+    "srcProto", "srcHostType", "srcHostName", "srcFileType", "srcFileName",
+    "dstProto", "dstHostType", "dstHostName", "dstFileType",
+    "userName", "password", MSG_STR_DELAY_SEC, NULL
+};
+
+/*
+ * build(request, respPort, respIpAddr) - returns XML string of the request
+ */
+static int l_build(lua_State *L)
+{
+    luaL_Buffer b;
+    int req, hdr, body, port, addr;
+    const char **f;
+    const char *msgType;
+    char type[MSG_MAX_STR_LEN];
+
+    luaL_checktype(L, 1, LUA_TTABLE);
+    lua_settop(L, 3);
+    req = 1; port = 2; addr = 3;
+
+    lua_getfield(L, req, "header");
+    hdr = lua_gettop(L);
+    luaL_checktype(L, hdr, LUA_TTABLE);
+    lua_getfield(L, req, "body");
+    body = lua_gettop(L);
+    if (!lua_istable(L, body))
+    {
+        lua_pop(L, 1);
+        lua_newtable(L);
+    }
+
+    lua_getfield(L, hdr, "msgType");
+    msgType = lua_tostring(L, -1);
+    strncpy(type, msgType ? msgType : "", sizeof(type) - 1);
+    type[sizeof(type) - 1] = '\0';
+    lua_pop(L, 1);
+
+    luaL_buffinit(L, &b);
+
+    add_open(&b, MSG_STR_ROOT_NAME);
+    add_open(&b, MSG_STR_HEADER);
+    add_field(L, &b, hdr, MSG_STR_CALLERID, NULL);
+    add_field(L, &b, hdr, MSG_STR_TXAID, NULL);
+    luaL_addstring(&b, "<" MSG_STR_RESPFLAG ">0</" MSG_STR_RESPFLAG ">");
+    add_field(L, &b, hdr, MSG_STR_RESPMODE, NULL);
+    lua_pushvalue(L, port);
+    add_elem_top(L, &b, MSG_STR_RESPPORT);
+    lua_pushvalue(L, addr);
+    add_elem_top(L, &b, MSG_STR_RESPADDR);
+    add_field(L, &b, hdr, MSG_STR_TYPE, NULL);
+    lua_getfield(L, hdr, MSG_STR_DBTYPE);
+    if (!lua_isnil(L, -1))
+        add_elem_top(L, &b, MSG_STR_DBTYPE);
+    else
+        lua_pop(L, 1);
+    lua_getfield(L, hdr, MSG_STR_VERSION);
+    if (!lua_isnil(L, -1))
+        add_elem_top(L, &b, MSG_STR_VERSION);
+    else
+        lua_pop(L, 1);
+    add_close(&b, MSG_STR_HEADER);
+
+    if (!strcmp(type, MSG_STR_GETPARAMVALUE) || !strcmp(type, "GetParamNextValue"))
+    {
+        add_open(&b, MSG_STR_BODY);
+        add_open(&b, type);
+        add_flag_field(L, &b, body, MSG_STR_NEXTLEVEL);
+        add_flag_field(L, &b, body, MSG_STR_CONFIGONLY);
+        add_list(L, &b, body, MSG_STR_PARAMNAMES, MSG_STR_PARAMNAMES, NULL, name_fields);
+    }
+    else if (!strcmp(type, MSG_STR_SETPARAMVALUE) || !strcmp(type, MSG_STR_ADDOBJECT))
+    {
+        add_open(&b, MSG_STR_BODY);
+        add_open(&b, type);
+        if (!strcmp(type, MSG_STR_SETPARAMVALUE))
+            add_field(L, &b, body, MSG_STR_SETTYPE, NULL);
+        else
+            add_field(L, &b, body, MSG_STR_OBJNAME, NULL);
+        add_list(L, &b, body, "paramNameValuePairs", MSG_STR_PARAMVALUES,
+                 MSG_STR_NAMEVALUEPAIR, nvpair_fields);
+    }
+    else if (!strcmp(type, MSG_STR_GETPARAMNAMES))
+    {
+        add_open(&b, MSG_STR_BODY);
+        add_open(&b, type);
+        add_field(L, &b, body, MSG_STR_PATHNAME, NULL);
+        add_field(L, &b, body, MSG_STR_NEXTLEVEL, NULL);
+    }
+    else if (!strcmp(type, MSG_STR_DELOBJECT))
+    {
+        add_open(&b, MSG_STR_BODY);
+        add_open(&b, type);
+        add_list(L, &b, body, MSG_STR_OBJECTS, MSG_STR_OBJECTS, NULL, objname_fields);
+    }
+    else if (!strcmp(type, MSG_STR_REBOOT))
+    {
+        add_open(&b, MSG_STR_BODY);
+        add_open(&b, type);
+        add_field(L, &b, body, MSG_STR_DELAY_SEC, NULL);
+    }
+    else if (!strcmp(type, MSG_STR_RESET))
+    {
+        add_open(&b, MSG_STR_BODY);
+        add_open(&b, type);
+        add_field(L, &b, body, MSG_STR_RESETTYPE, NULL);
+        add_field(L, &b, body, MSG_STR_DELAY_SEC, NULL);
+    }
+    else if (!strcmp(type, "Copy"))
+    {
+        add_open(&b, MSG_STR_BODY);
+        add_open(&b, type);
+        for (f = copy_fields; *f; f++)
+            add_field(L, &b, body, *f, NULL);
+    }
+    else if (!strcmp(type, MSG_STR_DISCOVERCONFIG))
+    {
+        add_open(&b, MSG_STR_BODY);
+        add_open(&b, type);
+        lua_getfield(L, body, MSG_STR_BACKENDNAME);
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            lua_pushliteral(L, "");
+        }
+        add_elem_top(L, &b, MSG_STR_BACKENDNAME);
+        lua_getfield(L, body, MSG_STR_OBJNAME);
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            lua_pushliteral(L, "");
+        }
+        add_elem_top(L, &b, MSG_STR_OBJNAME);
+    }
+    else
+        type[0] = '\0';   /* Unknown request has no body */
+
+    if (type[0])
+    {
+        add_close(&b, type);
+        add_close(&b, MSG_STR_BODY);
+    }
+    add_close(&b, MSG_STR_ROOT_NAME);
+
+    luaL_pushresult(&b);
+    return 1;
+}
+
+/* ---------------------------------------------------------------
+ * Response parser
+ * --------------------------------------------------------------- */
+
+static mxml_node_t *find_elem(mxml_node_t *node, const char *name)
+{
+    return mxmlFindElement(node, node, name, NULL, NULL, MXML_DESCEND);
+}
+
+/* Sets tbl[key] = text of the first 'key' element under 'node' (if any) */
+static void set_text_field(lua_State *L, int tbl, mxml_node_t *node, const char *key)
+{
+    const char *s;
+
+    if ((node = find_elem(node, key)) != NULL && (s = mxmlGetOpaque(node)) != NULL)
+    {
+        lua_pushstring(L, s);
+        lua_setfield(L, tbl, key);
+    }
+}
+
+/*
+ * Creates array of {f1 = ..., f2 = ...} tables from 'item_tag' elements of the
+ * first 'list_tag' element. Items without one of the fields are skipped.
+ */
+static void push_list(lua_State *L, mxml_node_t *tree, const char *list_tag,
+                      const char *item_tag, const char *f1, const char *f2)
+{
+    mxml_node_t *list, *item, *n1, *n2;
+    const char *s;
+    int i = 0;
+
+    lua_newtable(L);
+    if ((list = find_elem(tree, list_tag)) == NULL)
+        return;
+
+    for (item = mxmlFindElement(list, list, item_tag, NULL, NULL, MXML_DESCEND);
+         item != NULL;
+         item = mxmlFindElement(item, list, item_tag, NULL, NULL, MXML_NO_DESCEND))
+    {
+        n1 = find_elem(item, f1);
+        n2 = find_elem(item, f2);
+        if (n1 == NULL || n2 == NULL)
+            continue;
+
+        lua_createtable(L, 0, 2);
+        if ((s = mxmlGetOpaque(n1)) != NULL)
+        {
+            lua_pushstring(L, s);
+            lua_setfield(L, -2, f1);
+        }
+        if ((s = mxmlGetOpaque(n2)) != NULL)
+        {
+            lua_pushstring(L, s);
+            lua_setfield(L, -2, f2);
+        }
+        lua_rawseti(L, -2, ++i);
+    }
+}
+
+/* Equivalent of tonumber(s) == 0 */
+static int is_zero(const char *s)
+{
+    char *end;
+    double v;
+
+    if (s == NULL)
+        return 0;
+    v = strtod(s, &end);
+    if (end == s)
+        return 0;
+    while (*end == ' ' || *end == '\t' || *end == '\n' || *end == '\r')
+        end++;
+    return *end == '\0' && v == 0;
+}
+
+/* Sets body.status or hdr.resCode = MMX_ERROR_INTERNAL_ERROR if it is absent */
+static void set_status(lua_State *L, int hdr, int body, mxml_node_t *tree)
+{
+    set_text_field(L, body, tree, MSG_STR_STATUS);
+    lua_getfield(L, body, MSG_STR_STATUS);
+    if (lua_isnil(L, -1))
+    {
+        lua_pushinteger(L, MMX_ERROR_INTERNAL_ERROR);
+        lua_setfield(L, hdr, MSG_STR_RESPCODE);
+    }
+    lua_pop(L, 1);
+}
+
+/*
+ * parse(xml_str) - returns response table {hdr = {...}, body = {...}}
+ * or nil and error message
+ */
+static int l_parse(lua_State *L)
+{
+    const char *xml_str = luaL_checkstring(L, 1);
+    const char *type, *resCode;
+    mxml_node_t *tree, *node1, *node2;
+    int res, hdr, body;
+
+    tree = mxmlLoadString(NULL, xml_str, MXML_OPAQUE_CALLBACK);
+    if (tree == NULL)
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, "Could not parse XML message");
+        return 2;
+    }
+
+    lua_createtable(L, 0, 2);
+    res = lua_gettop(L);
+    lua_createtable(L, 0, 9);
+    hdr = lua_gettop(L);
+    lua_newtable(L);
+    body = lua_gettop(L);
+
+    set_text_field(L, hdr, tree, MSG_STR_CALLERID);
+    set_text_field(L, hdr, tree, MSG_STR_TXAID);
+    set_text_field(L, hdr, tree, MSG_STR_RESPCODE);
+    set_text_field(L, hdr, tree, MSG_STR_MOREFLAG);
+    set_text_field(L, hdr, tree, MSG_STR_TYPE);
+    set_text_field(L, hdr, tree, MSG_STR_DBTYPE);
+    set_text_field(L, hdr, tree, "flags");
+    set_text_field(L, hdr, tree, MSG_STR_VERSION);
+    set_text_field(L, hdr, tree, MSG_STR_DELTA);
+    set_text_field(L, hdr, tree, MSG_STR_FRAGMENT);
+
+    node1 = find_elem(tree, MSG_STR_TYPE);
+    type = node1 ? mxmlGetOpaque(node1) : NULL;
+    if (type == NULL)
+        type = "";
+    node1 = find_elem(tree, MSG_STR_RESPCODE);
+    resCode = node1 ? mxmlGetOpaque(node1) : NULL;
+
+    if (!is_zero(resCode) && strcmp(type, MSG_STR_SETPARAMVALUE_RESP))
+    {
+        /* Error response - body is not parsed */
+    }
+    else if (!strcmp(type, MSG_STR_GETPARAMVALUE_RESP) || !strcmp(type, "GetParamNextValueResponse"))
+    {
+        push_list(L, tree, MSG_STR_PARAMVALUES, MSG_STR_NAMEVALUEPAIR, MSG_STR_NAME, MSG_STR_VALUE);
+        lua_setfield(L, body, "paramNameValuePairs");
+    }
+    else if (!strcmp(type, MSG_STR_DELOBJECT_RESP))
+    {
+        set_status(L, hdr, body, tree);
+    }
+    else if (!strcmp(type, MSG_STR_SETPARAMVALUE_RESP))
+    {
+        if (is_zero(resCode))
+            set_status(L, hdr, body, tree);
+        else
+        {
+            push_list(L, tree, MSG_STR_PARAMFAULTS, MSG_STR_PARAMFAULT, MSG_STR_NAME, MSG_STR_FAULTCODE);
+            lua_setfield(L, body, MSG_STR_PARAMFAULTS);
+        }
+    }
+    else if (!strcmp(type, MSG_STR_GETPARAMNAMES_RESP))
+    {
+        push_list(L, tree, MSG_STR_PARAMLIST, MSG_STR_PARAMINFO, MSG_STR_NAME, MSG_STR_WRITABLE);
+        lua_setfield(L, body, "paramListArray");
+    }
+    else if (!strcmp(type, MSG_STR_ADDOBJECT_RESP))
+    {
+        node1 = find_elem(tree, MSG_STR_INST_NUMBER);
+        node2 = find_elem(tree, MSG_STR_STATUS);
+        if (node1 && node2)
+        {
+            set_text_field(L, body, tree, MSG_STR_INST_NUMBER);
+            set_text_field(L, body, tree, MSG_STR_STATUS);
+        }
+    }
+    else if (!strcmp(type, "CopyResponse"))
+    {
+        set_text_field(L, body, tree, MSG_STR_STATUS);
+        set_text_field(L, body, tree, "startTime");
+        set_text_field(L, body, tree, "completeTime");
+        set_text_field(L, body, tree, "resText");
+    }
+
+    mxmlDelete(tree);
+
+    lua_setfield(L, res, "body");
+    lua_setfield(L, res, "hdr");
+    return 1;
+}
+
+static const luaL_Reg mmx_frontapi_lib[] = {
+    { "build", l_build },
+    { "parse", l_parse },
+    { NULL, NULL }
+};
+
+int luaopen_mmx_frontapi(lua_State *L)
+{
+#if LUA_VERSION_NUM >= 502
+    luaL_newlib(L, mmx_frontapi_lib);
+#else
+    luaL_register(L, "mmx_frontapi", mmx_frontapi_lib);
+#endif
+    return 1;
+}
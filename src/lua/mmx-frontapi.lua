@@ -108,6 +108,8 @@ request = {
                            Possible values: "running", "startup", "candidate".
                            In case this node is absent, 
                            dbtype will be thought as "running".
+        version  = ''   -- Optional version of the values the caller already has
+                           (GetParamValue only, see mmx_frontapi_epexecute_delta)
     }, 
 
     body={  } -- Body of request - see the below examples
@@ -234,6 +236,10 @@ response = {
         moreFlag = '', -- 0 – this is the last resp msg, 1 – more resp will be sent
         msgType  = '', -- Type of EP request/response]
         resCode  = '', -- Operation result code; 0 – OK, otherwise error 
+        version  = '', -- Current version of the values (GetParamValueResponse, optional)
+        delta    = '', -- 1 - only values changed since version of the request,
+                       -- 2 - not modified (no values); absent - all values
+        fragment = '', -- Index of the fragment (from 1) of response with version, optional
 	flags    = '',
     },
     body = { <body> }   -- Body of request - see the below examples
@@ -322,7 +328,14 @@ response = {
 
 require "mmx.ing_utils"
 socklib = require"socket"
-xml = require("LuaXml")
+
+-- Native (C) implementation of building and parsing of EP messages.
+-- Without it the messages are handled by the Lua code below; LuaXml is
+-- loaded only for the rarely used requests that have no template.
+local native_ok, mmx_frontapi_native = pcall(require, "mmx_frontapi")
+if not native_ok then
+    mmx_frontapi_native = nil
+end
 
 local MMX_ERROR_NO_ERROR          = 0
 local MMX_ERROR_SOCKET_CREATE     = 11
@@ -333,8 +346,15 @@ local MMX_ERROR_FEREQUEST_ERROR   = 16
 
 local MMX_ERROR_INTERNAL_ERROR    = 9002
 
--- Log level (TODO: Should be moved to environment variable)
-local loglevel = 1
+-- Log levels
+MMX_LOG_NONE  = 0
+MMX_LOG_ERROR = 1
+MMX_LOG_INFO  = 2
+MMX_LOG_DEBUG = 3    -- includes dumps of requests and responses
+
+-- Log level is taken from MMX_FRONTAPI_LOGLEVEL environment variable
+-- and may be changed by mmx_frontapi_set_loglevel
+local loglevel = tonumber(os.getenv("MMX_FRONTAPI_LOGLEVEL")) or MMX_LOG_ERROR
 
 --Response mode: 0 - sync mode, 1 - async mode, 2 - response is not needed
 local MMX_RESMODE_NO_RESP = 2
@@ -344,35 +364,309 @@ local MAX_EP_RESP_TIMEOUT = 15
 local MIN_EP_RESP_TIMEOUT = 12
 
 local serveraddr = '127.0.0.1'
-local serverport_send = 10100    -- EP port
+-- EP port; may be overridden by MMX_FRONTAPI_EP_PORT (e.g. to use a mock EP)
+local serverport_send = tonumber(os.getenv("MMX_FRONTAPI_EP_PORT") or "") or 10100
 
 local clientAddr = '127.0.0.1'   -- 
-local clientport_receive = 4321  -- our port just fo testing !!! We need to think 
+
+-- Max size of EP response datagram
+local datagramLenMax = 32768
+
+-- Client socket shared by all requests of this Lua state. It is bound to
+-- an ephemeral port (sent to EP in respPort) once and reused, responses of
+-- different requests are distinguished by txaId.
+local sharedSock, sharedSockPort = nil, nil
+
+-- Batch of concurrent requests executed by mmx_frontapi_all (nil if there is
+-- no batch). It reads responses from the shared socket.
+local activeBatch = nil
 
 --[[ ------------------------------------
---   Function for printing logs
---    Input params:
---       compName      - Name of the backend and set file name
---	 (...)            - Log message
---    Returns:
---       Print log message in the file
---  TODO: Move the function from this file 
+--   Logging
+--    Lines are written to /var/log/mmx/<compName>.log only if their level
+--    is enabled. Function arguments are called (and other arguments are
+--    converted to strings) only in this case, so expensive dumps should be
+--    passed as functions, e.g.:
+--       logDebug("mmx-frontapi", "Response:", function() return ing.utils.tableToString(resp) end)
+--    Lines are buffered in memory and written in batches: when the buffer
+--    is full or old enough, after an error and when the Lua state is closed.
 -- ------------------------------------------]]
-function logMessage(compName,  ...)	
+local logpath = "/var/log/mmx"
+local LOG_BUFFER_MAX_LINES = 64
+local LOG_BUFFER_MAX_AGE   = 2     -- seconds
+
+local logBuffers = {}              -- compName -> array of lines
+local logBufferedLines, logBufferTime = 0, nil
+local logDateTime, logDateStr = nil, ""
 
-    local logpath = "/var/log/mmx"	
-    if (loglevel == 1) and compName and(type(compName) == "string") then
-        for i=1,#arg do arg[i]=tostring(arg[i]) end
+function mmx_frontapi_set_loglevel(level)
+    loglevel = tonumber(level) or loglevel
+end
+
+function mmx_frontapi_log_enabled(level)
+    return level <= loglevel
+end
 
+-- Buffered lines are flushed when the Lua state is closed. The guard is an
+-- upvalue of mmx_frontapi_log_flush, so it is not collected before that.
+local logFlushGuard
+if newproxy then
+    logFlushGuard = newproxy(true)
+    getmetatable(logFlushGuard).__gc = function() mmx_frontapi_log_flush() end
+else
+    logFlushGuard = setmetatable({}, {__gc = function() mmx_frontapi_log_flush() end})
+end
+
+function mmx_frontapi_log_flush()
+    local _ = logFlushGuard
+    for compName, lines in pairs(logBuffers) do
         local file = io.open(logpath.."/"..compName..".log","a")
-        if not file then 
-            file = io.open(logpath.."/"..compName..".log","a")
-        end
         if file then
-            file:write(os.date("[%Y-%m-%d %X] ")..(table.concat(arg," ")).."\n")
+            file:write(table.concat(lines, "\n"), "\n")
             file:close()
         end
     end
+    logBuffers = {}
+    logBufferedLines, logBufferTime = 0, nil
+end
+
+function mmx_frontapi_log(level, compName, ...)
+    if level > loglevel or type(compName) ~= "string" then
+        return
+    end
+
+    local n = select("#", ...)
+    local args = {...}
+    for i = 1, n do
+        if type(args[i]) == "function" then
+            args[i] = args[i]()
+        end
+        args[i] = tostring(args[i])
+    end
+
+    -- Date string is formatted once per second
+    local now = os.time()
+    if now ~= logDateTime then
+        logDateTime, logDateStr = now, os.date("[%Y-%m-%d %X] ", now)
+    end
+
+    local lines = logBuffers[compName]
+    if lines == nil then
+        lines = {}
+        logBuffers[compName] = lines
+    end
+    lines[#lines + 1] = logDateStr..table.concat(args, " ", 1, n)
+    logBufferedLines = logBufferedLines + 1
+    logBufferTime = logBufferTime or now
+
+    if level == MMX_LOG_ERROR or logBufferedLines >= LOG_BUFFER_MAX_LINES or
+       now - logBufferTime >= LOG_BUFFER_MAX_AGE then
+        mmx_frontapi_log_flush()
+    end
+end
+
+--[[ ------------------------------------
+--   Functions for printing logs of the corresponding level
+--    Input params:
+--       compName      - Name of the component, used as log file name
+--       (...)         - Log message
+-- ------------------------------------------]]
+function logMessage(compName, ...)
+    mmx_frontapi_log(MMX_LOG_INFO, compName, ...)
+end
+
+function logError(compName, ...)
+    mmx_frontapi_log(MMX_LOG_ERROR, compName, ...)
+end
+
+function logDebug(compName, ...)
+    mmx_frontapi_log(MMX_LOG_DEBUG, compName, ...)
+end
+
+--[[ ------------------------------------
+--   Runtime statistics of EP requests - the same counters as the C library
+--   keeps per connection (mmx-frontapi-stats.h). Disabled by default,
+--   see mmx_frontapi_stats_enable.
+--     requests, errors - tables of counts by msgType
+--     timeouts         - receive timeouts
+--     discarded        - responses with unexpected txaId or bad XML
+--     phases           - log2 latency histograms (us) of the phases
+--                        "build", "send", "wait" and "parse" (both per
+--                        received packet) and "total"
+-- ------------------------------------------]]
+local STATS_HIST_BUCKETS = 26
+local statsPhases = {"build", "send", "wait", "parse", "total"}
+local stats = nil
+
+local function stats_new()
+    local s = {requests = {}, errors = {}, timeouts = 0, discarded = 0, send_errors = 0,
+               packets_sent = 0, packets_received = 0, bytes_sent = 0, bytes_received = 0,
+               phases = {}}
+    for _, phase in ipairs(statsPhases) do
+        local buckets = {}
+        for i = 1, STATS_HIST_BUCKETS do buckets[i] = 0 end
+        s.phases[phase] = {count = 0, sum_us = 0, max_us = 0, buckets = buckets}
+    end
+    return s
+end
+
+local function stats_copy(tbl)
+    local copy = {}
+    for key, val in pairs(tbl) do
+        copy[key] = type(val) == "table" and stats_copy(val) or val
+    end
+    return copy
+end
+
+-- Returns start time of a phase (nil if statistics are disabled)
+local function stats_start()
+    return stats and socklib.gettime()
+end
+
+-- Records duration of the phase started at 'since'; returns current time
+local function stats_lap(phase, since)
+    if not stats or not since then
+        return nil
+    end
+    local now = socklib.gettime()
+    local us = math.max(math.floor((now - since) * 1e6), 0)
+    local hist = stats.phases[phase]
+
+    -- Bucket i+1 holds values of i bits: [2^(i-1), 2^i) us
+    local bucket, v = 1, us
+    while v > 0 and bucket < STATS_HIST_BUCKETS do
+        v = math.floor(v / 2)
+        bucket = bucket + 1
+    end
+    hist.buckets[bucket] = hist.buckets[bucket] + 1
+    hist.count = hist.count + 1
+    hist.sum_us = hist.sum_us + us
+    if us > hist.max_us then hist.max_us = us end
+    return now
+end
+
+local function stats_count(field, n)
+    if stats then
+        stats[field] = stats[field] + (n or 1)
+    end
+end
+
+-- Counts finished request and records its total duration
+local function stats_done(msgType, res, start)
+    if not stats then
+        return
+    end
+    stats_lap("total", start)
+    msgType = msgType or "Unknown"
+    stats.requests[msgType] = (stats.requests[msgType] or 0) + 1
+    if res ~= MMX_ERROR_NO_ERROR then
+        stats.errors[msgType] = (stats.errors[msgType] or 0) + 1
+    end
+end
+
+-- Enables (on = true) or disables and drops statistics
+function mmx_frontapi_stats_enable(on)
+    stats = on and (stats or stats_new()) or nil
+end
+
+-- Returns copy of the statistics (nil if disabled); if reset is set,
+-- counting starts anew
+function mmx_frontapi_stats_snapshot(reset)
+    if not stats then
+        return nil
+    end
+    local snap = stats
+    if reset then
+        stats = stats_new()
+    else
+        snap = stats_copy(stats)
+    end
+    return snap
+end
+
+-- Returns the upper bound (us) of the histogram bucket containing q-th
+-- quantile (0 < q <= 1), limited by max_us
+function mmx_frontapi_stats_percentile(hist, q)
+    if hist.count == 0 then
+        return 0
+    end
+    local rank = math.max(math.ceil(q * hist.count), 1)
+    local seen = 0
+    for i = 1, STATS_HIST_BUCKETS - 1 do
+        seen = seen + hist.buckets[i]
+        if seen >= rank then
+            return math.min(2 ^ (i - 1), hist.max_us)
+        end
+    end
+    return hist.max_us
+end
+
+-- Returns new socket bound to the local port (0 - ephemeral one) and the
+-- port, nil in case of failure
+local function mmx_frontapi_bind_socket(port)
+    local sock = socklib.udp(datagramLenMax)
+    if sock == nil then
+        return nil
+    end
+    if sock:setsockname(clientAddr, port) == nil then
+        sock:close()
+        return nil
+    end
+    local _, bound = sock:getsockname()
+    return sock, tonumber(bound)
+end
+
+--[[ ------------------------------------
+--   Returns socket for the request and local port of the socket
+--    Input params:
+--       udp_port - optional local port requested by the caller. In this 
+--                  case a dedicated socket is bound to this port,
+--                  otherwise the shared socket is used (or a dedicated
+--                  one bound to an ephemeral port, while the shared one
+--                  is read by the active batch)
+--    Returns:
+--       socket (nil in case of failure), port, flag "socket is shared"
+-- ------------------------------------------]]
+local function mmx_frontapi_get_socket(udp_port)
+    local clientsock
+
+    if udp_port ~= nil then
+        clientsock = mmx_frontapi_bind_socket(udp_port)
+        if clientsock == nil then
+            logError("mmx-frontapi", "Could not bind client socket to port", udp_port)
+            return nil
+        end
+        return clientsock, udp_port, false
+    end
+
+    if activeBatch ~= nil then
+        local port
+        clientsock, port = mmx_frontapi_bind_socket(0)
+        return clientsock, port, false
+    end
+
+    if sharedSock == nil then
+        sharedSock, sharedSockPort = mmx_frontapi_bind_socket(0)
+        if sharedSock == nil then
+            return nil
+        end
+        logMessage("mmx-frontapi", "Client socket is bound to port", sharedSockPort)
+    end
+
+    return sharedSock, sharedSockPort, true
+end
+
+--[[ ------------------------------------
+--   Releases socket got by mmx_frontapi_get_socket.
+--   The shared socket is kept open unless it failed.
+-- ------------------------------------------]]
+local function mmx_frontapi_release_socket(clientsock, shared, failed)
+    if not shared then
+        clientsock:close()
+    elseif failed and clientsock == sharedSock then
+        clientsock:close()
+        sharedSock, sharedSockPort = nil, nil
+    end
 end
 
 local function mmx_frontapi_send(clientsock, fe_request_xml)
@@ -382,11 +676,14 @@ local function mmx_frontapi_send(clientsock, fe_request_xml)
     --           (rc or "nil"),", errmsg = ",(errmsg or "nil"))
         
     if errmsg ~= nil then  -- send request to EP failed
+        stats_count("send_errors")
         return MMX_ERROR_SENDTO_ERROR
 
     else  -- send request to EP successed
         logMessage("mmx-frontapi", "mmx_frontapi_send:", string.format(
                     "Request (%d bytes) to EntryPoint is sent to %s:%s", rc, serveraddr, serverport_send)) 
+        stats_count("packets_sent")
+        stats_count("bytes_sent", #fe_request_xml)
         return MMX_ERROR_NO_ERROR 
     end
 end
@@ -395,16 +692,27 @@ local function mmx_frontapi_receive(clientsock)
 
     local ep_response, remoteaddr, remoteport = clientsock:receivefrom()
 
-    --Validate response status
-    if (ep_response == nil) and (remoteaddr == 'timeout') then 
+    --Validate response status (remoteaddr contains error message)
+    if ep_response == nil then 
+        if remoteaddr == "timeout" then
+            stats_count("timeouts")
+        end
         return MMX_ERROR_RECEIVEFROM_ERROR , {}
     else
+        stats_count("packets_received")
+        stats_count("bytes_received", #ep_response)
         return MMX_ERROR_NO_ERROR, ep_response, remoteaddr, remoteport
     end
 
 end
 
-local function mmx_frontapi_message_build(fe_request, port)
+-- Builds request using LuaXml tree; used for message types without
+-- template in requestBodyTemplates
+local function mmx_frontapi_message_build_xml(fe_request, port)
+    if not xml then
+        xml = require("LuaXml")
+    end
+
     local reqMsgType = fe_request.header.msgType
 
     --Create root node
@@ -432,6 +740,10 @@ local function mmx_frontapi_message_build(fe_request, port)
         hdr.dbType = xml.new("dbType")
         table.insert(hdr.dbType, fe_request.header.dbType)
     end
+    if (fe_request.header.version) then
+        hdr.version = xml.new("version")
+        table.insert(hdr.version, fe_request.header.version)
+    end
     root:append(hdr)
 
     --Fill in body node values 
@@ -603,146 +915,377 @@ local function mmx_frontapi_message_build(fe_request, port)
         return xml.str(root)
 end
 
-local function mmx_frontapi_message_parse(ep_response)
+--[[-------------------------------------------------------------------------
+  Template-based request builder.
+     The common requests are built by concatenation of precomputed tag
+     strings and escaped values (the same bytes as the native module
+     produces), without creating LuaXml nodes.
+-------------------------------------------------------------------------]]
+local xmlEscapes = {["&"] = "&amp;", ["<"] = "&lt;", [">"] = "&gt;",
+                    ['"'] = "&quot;", ["'"] = "&apos;"}
 
-    local resTab, res_header, res_body = {}, {}, {}
-    local xname, xvalue, xstatus = nil, nil, nil
-    local xList = {}
+local function xml_escape(str)
+    if not string.find(str, "[&<>\"']") then
+        return str
+    end
+    return (string.gsub(str, "[&<>\"']", xmlEscapes))
+end
 
-    --converts an XML string to a Lua table for work with LuaXml lib
-    local respXml = xml.eval(ep_response);
+-- Tag strings are created once per tag name
+local openTag = setmetatable({}, {__index = function(t, tag)
+    local v = "<" .. tag .. ">"; t[tag] = v; return v end})
+local closeTag = setmetatable({}, {__index = function(t, tag)
+    local v = "</" .. tag .. ">"; t[tag] = v; return v end})
+local emptyTag = setmetatable({}, {__index = function(t, tag)
+    local v = "<" .. tag .. "/>"; t[tag] = v; return v end})
+
+-- Appends element with text of the value to buf (n - current length of buf).
+-- nil value produces an empty element. Returns new length of buf.
+local function tmpl_add_elem(buf, n, tag, value)
+    local vtype = type(value)
+    if vtype == "string" or vtype == "number" then
+        value = xml_escape(tostring(value))
+    elseif vtype == "boolean" then
+        value = value and "true" or "false"
+    else
+        buf[n + 1] = emptyTag[tag]
+        return n + 1
+    end
+    buf[n + 1] = openTag[tag]
+    buf[n + 2] = value
+    buf[n + 3] = closeTag[tag]
+    return n + 3
+end
 
-    --Parse XML header and fill header of the resulting table
-    xvalue = respXml:find("callerId") or {}
-    res_header.callerId = xvalue[1]
+-- Appends "true"/"false" element for flag that is set
+local function tmpl_add_flag(buf, n, tag, value)
+    if not value then
+        return n
+    end
+    buf[n + 1] = openTag[tag]
+    buf[n + 2] = (value == true) and "true" or "false"
+    buf[n + 3] = closeTag[tag]
+    return n + 3
+end
 
-    xvalue = respXml:find("txaId") or {}
-    res_header.txaId = xvalue[1]
+-- Appends list element with 'fields' of every table item of 'list'
+-- wrapped into 'itemTag' (if given)
+local function tmpl_add_list(buf, n, list, listTag, itemTag, fields)
+    local count = (type(list) == "table") and #list or 0
+    n = n + 1
+    buf[n] = '<' .. listTag .. ' arraySize="' .. count .. '">'
+    for i = 1, count do
+        local item = list[i]
+        if type(item) == "table" then
+            if itemTag then
+                n = n + 1
+                buf[n] = openTag[itemTag]
+            end
+            for _, field in ipairs(fields) do
+                n = tmpl_add_elem(buf, n, field, item[field])
+            end
+            if itemTag then
+                n = n + 1
+                buf[n] = closeTag[itemTag]
+            end
+        end
+    end
+    n = n + 1
+    buf[n] = closeTag[listTag]
+    return n
+end
 
-    xvalue = respXml:find("resCode") or {}
-    res_header.resCode = xvalue[1]
+local nameFields    = {"name"}
+local nvpairFields  = {"name", "value"}
+local objNameFields = {"objName"}
 
-    xvalue = respXml:find("moreFlag") or {}
-    res_header.moreFlag = xvalue[1]
+local function tmpl_get_param_value(buf, n, body)
+    n = tmpl_add_flag(buf, n, "nextLevel", body.nextLevel)
+    n = tmpl_add_flag(buf, n, "configOnly", body.configOnly)
+    return tmpl_add_list(buf, n, body.paramNames, "paramNames", nil, nameFields)
+end
 
-    xvalue = respXml:find("msgType") or {}
-    res_header.msgType  = xvalue[1]
-    
-    -- DB Type is an "optional" parameter
-    xvalue = respXml:find("dbType")
-    if xvalue ~= nil then res_header.dbType  = xvalue[1] end
+-- Fillers of the request body (inside <body><msgType>) per message type
+local requestBodyTemplates = {
+    GetParamValue     = tmpl_get_param_value,
+    GetParamNextValue = tmpl_get_param_value,
+
+    SetParamValue = function(buf, n, body)
+        n = tmpl_add_elem(buf, n, "setType", body.setType)
+        return tmpl_add_list(buf, n, body.paramNameValuePairs, "paramValues",
+                             "nameValuePair", nvpairFields)
+    end,
+
+    AddObject = function(buf, n, body)
+        n = tmpl_add_elem(buf, n, "objName", body.objName)
+        return tmpl_add_list(buf, n, body.paramNameValuePairs, "paramValues",
+                             "nameValuePair", nvpairFields)
+    end,
+
+    GetParamNames = function(buf, n, body)
+        n = tmpl_add_elem(buf, n, "pathName", body.pathName)
+        return tmpl_add_elem(buf, n, "nextLevel", body.nextLevel)
+    end,
+
+    DelObject = function(buf, n, body)
+        return tmpl_add_list(buf, n, body.objects, "objects", nil, objNameFields)
+    end,
+}
 
-    xvalue = respXml:find("flags") or {}
-    res_header.flags = xvalue[1]
-    
-     if tonumber(res_header.resCode) ~= MMX_ERROR_NO_ERROR and 
-        res_header.msgType ~= "SetParamValueResponse" then
+local function mmx_frontapi_message_build(fe_request, port)
+    if mmx_frontapi_native then
+        return mmx_frontapi_native.build(fe_request, port, clientAddr)
+    end
+
+    local header = fe_request.header
+    local msgType = header.msgType
+    local bodyTemplate = requestBodyTemplates[msgType]
+    if not bodyTemplate then
+        return mmx_frontapi_message_build_xml(fe_request, port)
+    end
+
+    local buf = {"<EP_ApiMsg><hdr>"}
+    local n = 1
+    n = tmpl_add_elem(buf, n, "callerId", header.callerId)
+    n = tmpl_add_elem(buf, n, "txaId", header.txaId)
+    n = n + 1
+    buf[n] = "<respFlag>0</respFlag>"
+    n = tmpl_add_elem(buf, n, "respMode", header.respMode)
+    n = tmpl_add_elem(buf, n, "respPort", port)
+    n = tmpl_add_elem(buf, n, "respIpAddr", clientAddr)
+    n = tmpl_add_elem(buf, n, "msgType", msgType)
+    if header.dbType ~= nil then
+        n = tmpl_add_elem(buf, n, "dbType", header.dbType)
+    end
+    if header.version ~= nil then
+        n = tmpl_add_elem(buf, n, "version", header.version)
+    end
+    buf[n + 1] = "</hdr><body>"
+    buf[n + 2] = openTag[msgType]
+    n = bodyTemplate(buf, n + 2, fe_request.body or {})
+    buf[n + 1] = closeTag[msgType]
+    buf[n + 2] = "</body></EP_ApiMsg>"
+
+    return table.concat(buf, "", 1, n + 2)
+end
+
+--[[-------------------------------------------------------------------------
+  Pattern-based response parser.
+     The response is scanned once with string.find; the texts of leaf
+     elements are stored directly to the header, to the items of the
+     response lists (nameValuePair, paramFault, paramInfo) or to the
+     body fields, so no intermediate XML tree is created.
+-------------------------------------------------------------------------]]
+local xmlEntities = {lt = "<", gt = ">", amp = "&", quot = '"', apos = "'"}
+
+local function xml_entity(ent)
+    local code
+    if string.sub(ent, 1, 2) == "#x" then
+        code = tonumber(string.sub(ent, 3), 16)
+    elseif string.sub(ent, 1, 1) == "#" then
+        code = tonumber(string.sub(ent, 2))
+    else
+        return xmlEntities[ent]
+    end
+    if code and code < 256 then
+        return string.char(code)
+    end
+end
+
+local function xml_unescape(str)
+    if not string.find(str, "&", 1, true) then
+        return str
+    end
+    return (string.gsub(str, "&(#?%w+);", xml_entity))
+end
+
+local responseHeaderFields = {callerId = true, txaId = true, resCode = true,
+                              moreFlag = true, msgType = true, dbType = true,
+                              flags = true, version = true, delta = true,
+                              fragment = true}
+
+-- Item elements of the response lists and their fields
+local responseItems = {
+    nameValuePair = {"name", "value"},
+    paramFault    = {"name", "faultcode"},
+    paramInfo     = {"name", "writable"},
+}
+
+--[[
+  Scans XML response. Returns header table, table of item lists (keyed by
+  item tag) and table of the other leaf elements of the body (first
+  occurrence of every tag), or nil if the message has no header.
+  Texts of empty body elements are "" here; items without one of their
+  fields are dropped, as the native parser does.
+--]]
+local function mmx_frontapi_response_scan(ep_response)
+    local header, lists, fields = {}, {}, {}
+    local pos, inHdr, hasHdr = 1, false, false
+    local lastOpen, textStart
+    local item, itemTag, itemFields
+
+    while true do
+        local s, e, slash, tag, empty = string.find(ep_response, "<(/?)([%w_:%.%-]+)[^>]-(/?)>", pos)
+        if not s then
+            break
+        end
+        pos = e + 1
+
+        if slash == "" and empty == "" then
+            -- Opening tag
+            if tag == "hdr" then
+                inHdr, hasHdr = true, true
+            elseif not inHdr and responseItems[tag] then
+                item, itemTag, itemFields = {}, tag, responseItems[tag]
+            end
+            lastOpen, textStart = tag, pos
+
+        else
+            local text
+            if slash == "" then
+                -- Empty element <tag/>
+                text = ""
+            elseif lastOpen == tag then
+                text = xml_unescape(string.sub(ep_response, textStart, s - 1))
+            end
+
+            if text ~= nil then
+                -- Leaf element
+                if inHdr then
+                    if responseHeaderFields[tag] and header[tag] == nil then
+                        header[tag] = text
+                    end
+                elseif item then
+                    if item[tag] == nil then item[tag] = text end
+                elseif fields[tag] == nil then
+                    fields[tag] = text
+                end
+            elseif tag == "hdr" then
+                inHdr = false
+            elseif item and tag == itemTag then
+                local f1, f2 = itemFields[1], itemFields[2]
+                if item[f1] ~= nil and item[f2] ~= nil then
+                    if item[f1] == "" then item[f1] = nil end
+                    if item[f2] == "" then item[f2] = nil end
+                    local list = lists[itemTag]
+                    if not list then
+                        list = {}
+                        lists[itemTag] = list
+                    end
+                    list[#list + 1] = item
+                end
+                item = nil
+            end
+            lastOpen = nil
+        end
+    end
+
+    if not hasHdr then
+        return nil
+    end
+    for key, val in pairs(header) do
+        if val == "" then header[key] = nil end
+    end
+    return header, lists, fields
+end
+
+local function mmx_frontapi_message_parse(ep_response)
+
+    local resTab, res_header, res_body = {}, {}, {}
+
+    if mmx_frontapi_native then
+        local errmsg
+        resTab, errmsg = mmx_frontapi_native.parse(ep_response)
+        if resTab == nil then
+            logError("mmx-frontapi", "message_parse: ERROR -", errmsg)
+            return MMX_ERROR_XML_PARSE, {}
+        end
+        if tonumber(resTab.hdr.resCode) ~= MMX_ERROR_NO_ERROR and
+           resTab.hdr.msgType ~= "SetParamValueResponse" then
+            logMessage("mmx-frontapi", "message_parse: response with bad resCode: \n",
+                       function() return ing.utils.tableToString(resTab) end)
+        end
+        return MMX_ERROR_NO_ERROR, resTab
+    end
+
+    local lists, fields
+    res_header, lists, fields = mmx_frontapi_response_scan(ep_response)
+    if res_header == nil then
+        logError("mmx-frontapi", "message_parse: ERROR - could not parse XML message")
+        return MMX_ERROR_XML_PARSE, {}
+    end
+
+    -- Texts of empty body elements are treated as absent
+    local function field(tag)
+        local val = fields[tag]
+        if val ~= "" then return val end
+    end
+
+    if tonumber(res_header.resCode) ~= MMX_ERROR_NO_ERROR and
+       res_header.msgType ~= "SetParamValueResponse" then
         resTab={hdr = res_header, body = res_body}
-        logMessage("mmx-frontapi", "message_parse: response with bad resCode: \n", ing.utils.tableToString(resTab)) 
+        logMessage("mmx-frontapi", "message_parse: response with bad resCode: \n",
+                   function() return ing.utils.tableToString(resTab) end)
         return MMX_ERROR_NO_ERROR, resTab
-     end 
- 
-     -- Parse body of XML response message
-     if res_header.msgType == "GetParamValueResponse" or 
+    end
+
+    -- Parse body of XML response message
+    if res_header.msgType == "GetParamValueResponse" or
        res_header.msgType == "GetParamNextValueResponse" then
+        res_body = {paramNameValuePairs = lists.nameValuePair or {}}
 
-        res_body = {paramNameValuePairs={}}
-        xList = respXml:find("paramValues")
-        --logMessage("mmx-frontapi", "message_parse: Debug print - paramValues: \n", ing.utils.tableToString(xList)) 
-
-        for i, elem in ipairs(xList or {}) do
-            -- process the nameValuePair elements, extract names and values
-            if (elem:tag() == "nameValuePair") then
-                xname  = elem:find("name")
-                xvalue = elem:find("value")
-                if xname and xvalue  then
-                    table.insert(res_body.paramNameValuePairs, {name = xname[1], value = xvalue[1]})
-                else
-                   logMessage("mmx-frontapi", string.format("message_parse: ERROR - wrong format of EP response name-value pair (%s)", i))
-                end
+    elseif res_header.msgType == "DelObjectResponse" then
+        if field("status") then
+            res_body = {status = field("status")}
+        else
+            res_header.resCode = MMX_ERROR_INTERNAL_ERROR
+            logError("mmx-frontapi", string.format("message_parse: ERROR - msg %s does not contain XML tag 'status'", res_header.msgType))
+        end
+
+    elseif res_header.msgType == "SetParamValueResponse" then
+        if tonumber(res_header.resCode) == MMX_ERROR_NO_ERROR then
+            --Response message in case of success
+            if field("status") then
+                res_body = {status = field("status")}
+            else
+                res_header.resCode = MMX_ERROR_INTERNAL_ERROR
+                logError("mmx-frontapi", string.format(
+                           "message_parse: ERROR - successful msg %s does not contain XML tag 'status'",
+                           res_header.msgType))
             end
+        else
+            --Response message with faults
+            res_body = {paramFaults = lists.paramFault or {}}
         end
-        --logMessage("mmx-frontapi", "message_parse: response body for GetParamValues: \n", ing.utils.tableToString(res_body))  
-
-     elseif res_header.msgType == "DelObjectResponse" then
-         xstatus = respXml:find("status")
-         if xstatus and xstatus[1] then
-             res_body = {status = xstatus[1]}
-         else
-             res_header.resCode = MMX_ERROR_INTERNAL_ERROR 
-             logMessage("mmx-frontapi", string.format("message_parse: ERROR - msg %s does not contain XML tag 'status'", res_header.msgType))             
-         end
-
-     elseif res_header.msgType == "SetParamValueResponse" then
-         if tonumber(res_header.resCode) == MMX_ERROR_NO_ERROR then
-             --Response message in case of success
-             xstatus = respXml:find("status")
-             if xstatus and xstatus[1] then
-                 res_body = {status = xstatus[1]}
-             else
-                 res_header.resCode = MMX_ERROR_INTERNAL_ERROR 
-                 logMessage("mmx-frontapi", string.format(
-                            "message_parse: ERROR - successful msg %s does not contain XML tag 'status'",
-                            res_header.msgType))             
-             end
-         else
-             --Response message with faults
-             res_body = {paramFaults={}}
-             xList = respXml:find("paramFaults")
-             for i, elem in ipairs(xList or {}) do
-                 -- process paramFault; extract the "name" and "faultcode" of parameter
-                 if (elem:tag() == "paramFault") then
-                     xname = elem:find("name")
-                     xfaultcode = elem:find("faultcode")
-                     if xname and xfaultcode  then
-                         table.insert(res_body.paramFaults, {name = xname[1], faultcode = xfaultcode[1]})
-                     end
-                 end
-             end
-         end
-    
-     elseif res_header.msgType == "GetParamNamesResponse" then
-         res_body = {paramListArray={}}
-         xList = respXml:find("paramList")
-         for i, elem in ipairs(xList or {}) do
-             -- process paramInfo; extract the "name" and "writable" of parameter
-             if (elem:tag() == "paramInfo") then
-                 xname = elem:find("name")
-                 xwritable = elem:find("writable")
-                if xname and xwritable  then
-                    table.insert(res_body.paramListArray, {name = xname[1], writable = xwritable[1]})
-                end
-             end
-         end
-    
-     elseif res_header.msgType == "AddObjectResponse" then
-         local xobjInstanceNumber = respXml:find("objInstanceNumber")
-         xstatus = respXml:find("status")
-         if xobjInstanceNumber and xstatus then
-             res_body={objInstanceNumber = xobjInstanceNumber[1], status = xstatus[1]}
-         end
-     elseif res_header.msgType == "CopyResponse" then
-
-         xstatus = respXml:find("status")
-         if xstatus and xstatus[1] then res_body.status = xstatus[1] end
-        
-         xvalue = respXml:find("startTime")
-         if xvalue and xvalue[1] then res_body.startTime = xvalue[1] end
 
-         xvalue = respXml:find("completeTime")
-         if xvalue and xvalue[1] then res_body.completeTime = xvalue[1] end
+    elseif res_header.msgType == "GetParamNamesResponse" then
+        res_body = {paramListArray = lists.paramInfo or {}}
 
-         xvalue = respXml:find("resText")
-         if xvalue and xvalue[1] then res_body.resText = xvalue[1] end		
-     end
+    elseif res_header.msgType == "AddObjectResponse" then
+        if fields.objInstanceNumber and fields.status then
+            res_body = {objInstanceNumber = field("objInstanceNumber"), status = field("status")}
+        end
+
+    elseif res_header.msgType == "CopyResponse" then
+        res_body.status       = field("status")
+        res_body.startTime    = field("startTime")
+        res_body.completeTime = field("completeTime")
+        res_body.resText      = field("resText")
+    end
 
-     --Make full result table
-     resTab={hdr = res_header, body = res_body}
-     --logMessage("mmx-frontapi", string.format("message_parse: full response for %s message:\n %s",
-     --           res_header.msgType, ing.utils.tableToString(resTab))  
-     return MMX_ERROR_NO_ERROR, resTab
+    --Make full result table
+    resTab={hdr = res_header, body = res_body}
+    return MMX_ERROR_NO_ERROR, resTab
 end
 
+-- Fields of response bodies known to be arrays. Their fragments are
+-- appended without checking the tables with is_array.
+local responseArrayFields = {
+    paramNameValuePairs = true,
+    paramFaults         = true,
+    paramListArray      = true,
+}
+
 local function is_array(x)
     local count = 0
     for _ in pairs(x) do
@@ -757,17 +1300,35 @@ end
      This function is used for collecting fragmented response from EP and performs updating 
      content of buffered response (orig_resp) with content of single response fragment (add_resp).
                     
+     Arrays known from the response schema (responseArrayFields) are
+     appended in time proportional to the size of the fragment; other
+     tables are merged recursively.
   Input parameters: 
      orig_resp - original parsed response, will be extended with data from add_resp
      add_resp  - additional parsed response, its body will extend original response's body 
                  and its header will overwrite header of original response 
+     lengths   - optional table keeping lengths of the collected arrays 
+                 between calls for the same orig_resp (an empty table
+                 should be passed with the first fragment)
   Output: 
      No output
 -------------------------------------------------------------------------]]
-function mmx_frontapi_message_merge(orig_tbl, add_tbl)
+function mmx_frontapi_message_merge(orig_tbl, add_tbl, lengths)
     for key, elem in pairs(add_tbl or {}) do
         local orig_elem = orig_tbl[key]
-        if type(orig_elem) == "table" and type(elem) == "table" then
+        if responseArrayFields[key] and type(elem) == "table" then
+            if type(orig_elem) ~= "table" then
+                orig_tbl[key] = elem
+                if lengths then lengths[key] = #elem end
+            else
+                local n = (lengths and lengths[key]) or #orig_elem
+                local count = #elem
+                for i = 1, count do
+                    orig_elem[n + i] = elem[i]
+                end
+                if lengths then lengths[key] = n + count end
+            end
+        elseif type(orig_elem) == "table" and type(elem) == "table" then
             local is_orig_array = is_array(orig_elem)
             local is_elem_array = is_array(elem)
             if is_orig_array and is_elem_array then
@@ -785,10 +1346,231 @@ function mmx_frontapi_message_merge(orig_tbl, add_tbl)
     end
 end
 
+--[[
+  Path trie of the parameter names: node[segment] is the child node for
+  the next part of the name and node[1] is the full name of the parameter
+  ending at the node (segments are always strings, so keys do not clash).
+--]]
+local function mmx_frontapi_trie_insert(trie, name)
+    local node = trie
+    for segment in string.gmatch(name, "[^%.]+") do
+        local child = node[segment]
+        if child == nil then
+            child = {}
+            node[segment] = child
+        end
+        node = child
+    end
+    node[1] = name
+end
+
+--[[--------------------------------------------------------------------
+  Function name: mmx_frontapi_param_index
+  Description:
+     Builds lookup index over name-value pairs of GetParamValue response
+     (response.body.paramNameValuePairs). Values are then found by full
+     name in O(1) and object subtrees are selected with 
+     mmx_frontapi_index_range instead of scanning all the pairs.
+  Input parameters: 
+     paramPairs - array of {name = ..., value = ...} tables
+     index      - optional index to be extended (e.g. when the parameters
+                  are collected by several requests)
+  Output: 
+     index - table, index.values[name] is value of the parameter
+-------------------------------------------------------------------------]]
+function mmx_frontapi_param_index(paramPairs, index)
+    index = index or {values = {}, names = {}}
+    local values, names = index.values, index.names
+
+    for _, pair in ipairs(paramPairs or {}) do
+        if pair.name ~= nil then
+            if values[pair.name] == nil then
+                names[#names + 1] = pair.name
+                if index.trie then
+                    mmx_frontapi_trie_insert(index.trie, pair.name)
+                end
+            end
+            values[pair.name] = pair.value
+        end
+    end
+    index.sorted = false
+
+    return index
+end
+
+--[[--------------------------------------------------------------------
+  Function name: mmx_frontapi_index_range
+  Description:
+     Returns iterator over parameters of the index whose names start with
+     the prefix (e.g. "Device.IP.Interface.1."), in the order of names.
+  Input parameters: 
+     index  - index built by mmx_frontapi_param_index
+     prefix - prefix of parameter names
+  Output: 
+     iterator returning name and value of the parameter
+-------------------------------------------------------------------------]]
+function mmx_frontapi_index_range(index, prefix)
+    local names = index.names
+    if not index.sorted then
+        table.sort(names)
+        index.sorted = true
+    end
+
+    -- binary search of the first name not less than the prefix
+    local lo, hi = 1, #names + 1
+    while lo < hi do
+        local mid = math.floor((lo + hi) / 2)
+        if names[mid] < prefix then
+            lo = mid + 1
+        else
+            hi = mid
+        end
+    end
+
+    local prefixLen = #prefix
+    return function()
+        local name = names[lo]
+        if name ~= nil and string.sub(name, 1, prefixLen) == prefix then
+            lo = lo + 1
+            return name, index.values[name]
+        end
+    end
+end
+
+--[[--------------------------------------------------------------------
+  Function name: mmx_frontapi_index_match
+  Description:
+     Selects parameters of the index that belong to objects matching the
+     path with placeholders ("*" or "{i}" stand for any instance number),
+     e.g. "Device.WiFi.AccessPoint.*.AssociatedDevice.*.". The path trie
+     of the index is built on the first call, and only the branches
+     matching the path are visited.
+  Input parameters: 
+     index   - index built by mmx_frontapi_param_index
+     path    - partial path to objects (ends with "."), may have placeholders
+     wanted  - set of needed parameter names ({Name = true, ...}),
+               nil for all parameters
+  Output: 
+     table with object paths as keys and tables of their parameters
+     ({paramName = value, ...}) as values
+-------------------------------------------------------------------------]]
+function mmx_frontapi_index_match(index, path, wanted)
+    local trie = index.trie
+    if trie == nil then
+        trie = {}
+        for _, name in ipairs(index.names) do
+            mmx_frontapi_trie_insert(trie, name)
+        end
+        index.trie = trie
+    end
+
+    local pattern = {}
+    for segment in string.gmatch(path, "[^%.]+") do
+        pattern[#pattern + 1] = segment
+    end
+
+    local values = index.values
+    local result = {}
+    local segments = {}
+
+    -- Collects parameters of the node and of all its subobjects
+    local function collect(node, depth)
+        local objPath
+        for segment, child in pairs(node) do
+            if type(segment) == "string" then
+                if child[1] ~= nil and (wanted == nil or wanted[segment]) then
+                    if objPath == nil then
+                        objPath = table.concat(segments, ".", 1, depth) .. "."
+                        result[objPath] = result[objPath] or {}
+                    end
+                    result[objPath][segment] = values[child[1]]
+                end
+                segments[depth + 1] = segment
+                collect(child, depth + 1)
+            end
+        end
+    end
+
+    local function walk(node, depth)
+        if depth == #pattern then
+            collect(node, depth)
+            return
+        end
+        local segment = pattern[depth + 1]
+        if segment == "*" or segment == "{i}" then
+            for key, child in pairs(node) do
+                if type(key) == "string" and tonumber(key) then
+                    segments[depth + 1] = key
+                    walk(child, depth + 1)
+                end
+            end
+        elseif node[segment] ~= nil then
+            segments[depth + 1] = segment
+            walk(node[segment], depth + 1)
+        end
+    end
+
+    walk(trie, 0)
+    return result
+end
+
 -- =============================================
 --      API functions
 -- =============================================
 
+-- Counts a received fragment of the response and returns the new count.
+-- Numbered fragments must come in order (see mmx_frontapi_delta_merge),
+-- otherwise the response is marked incomplete.
+local function mmx_frontapi_count_fragment(response, hdr, fragments)
+    fragments = fragments + 1
+    local index = tonumber(hdr["fragment"])
+    if (index and index ~= fragments) or (not index and fragments > 1) then
+        response.incomplete = true
+    end
+    return fragments
+end
+
+--[[--------------------------------------------------------------------
+  Function name: mmx_frontapi_execute_async
+  Description:
+     Sends request of a task of the active batch and suspends the task 
+     (its coroutine) until the whole response is received by
+     mmx_frontapi_all or the deadline of the batch is reached.
+  Input/Output: the same as for mmx_frontapi_epexecute_lua
+-------------------------------------------------------------------------]]
+local function mmx_frontapi_execute_async(fe_request, fragment_handler)
+    local func = "mmx_frontapi_execute_async:"
+    local batch = activeBatch
+    local txaId = tostring(fe_request.header.txaId)
+
+    if batch.closed or socklib.gettime() >= batch.deadline then
+        logError("mmx-frontapi", func, "Deadline of the batch is reached,", fe_request.header.msgType,
+                   "request is not sent")
+        return MMX_ERROR_RECEIVEFROM_ERROR, {body={}}
+    end
+    if batch.waiting[txaId] ~= nil then
+        logError("mmx-frontapi", func, "Request with txaId", txaId, "is already in progress")
+        return MMX_ERROR_FEREQUEST_ERROR, {body={}}
+    end
+
+    local start = stats_start()
+    local fe_request_xml = mmx_frontapi_message_build(fe_request, batch.port)
+    local t = stats_lap("build", start)
+    local res = mmx_frontapi_send(batch.sock, "00000000"..fe_request_xml)
+    stats_lap("send", t)
+    if res ~= MMX_ERROR_NO_ERROR or tonumber(fe_request.header.respMode) == MMX_RESMODE_NO_RESP then
+        stats_done(fe_request.header.msgType, res, start)
+        return res, {body={}}
+    end
+
+    batch.waiting[txaId] = {co = coroutine.running(), handler = fragment_handler,
+                            response = {body={}}, lengths = {}, fragments = 0}
+    local ep_res, ep_response = coroutine.yield()
+    stats_done(fe_request.header.msgType, ep_res, start)
+    return ep_res, ep_response
+end
+
+
 --[[--------------------------------------------------------------------
   Function name: mmx_frontapi_epexecute_lua
   Description:
@@ -804,6 +1586,14 @@ end
   Input parameters: 
      fe_request - request from frontend to EP in Lua table format
      timeout    - value of timeout for response 
+     udp_port   - optional local UDP port used for receiving the response.
+                  By default the shared client socket bound to an 
+                  ephemeral port is used.
+     fragment_handler - optional function called with every parsed response
+                  fragment as soon as it is received. In this case the
+                  fragments are not merged into ep_response (its body is
+                  empty), so big responses (e.g. export of the whole
+                  data model) are processed in constant memory.
   Output: 
      res_code    - integer result code: 0 - in case of success, 
                                         otherwise - failure
@@ -812,38 +1602,32 @@ end
                    if response is not needed (i.e response mode of the 
                    request header is "2"), this parameter comtains empty table.
 -------------------------------------------------------------------------]]
-function mmx_frontapi_epexecute_lua(fe_request,  timeout, udp_port)
+function mmx_frontapi_epexecute_lua(fe_request,  timeout, udp_port, fragment_handler)
 
     local func = "mmx_frontapi_epexecute_lua:"
     local res, ep_response_tab, msgType, awaitTxId = MMX_ERROR_NO_ERROR, {body={}}, "", nil
     local ep_response_xml
     local wait_for_response = false
-    local datagramLenMax = 32768
+    local clientsock, shared
     --Validate input
     if next(fe_request or {}, nil) == nil then
-        logMessage("mmx-frontapi",func, "Empty request from frontend")
+        logError("mmx-frontapi",func, "Empty request from frontend")
         return MMX_ERROR_FEREQUEST_ERROR, {}
     end
-    if udp_port == nil then
-        udp_port = clientport_receive
+    -- Requests of tasks run by mmx_frontapi_all are executed concurrently
+    if activeBatch ~= nil and activeBatch.tasks[coroutine.running()] ~= nil then
+        return mmx_frontapi_execute_async(fe_request, fragment_handler)
     end
     logMessage("mmx-frontapi","========== New request", fe_request.header.msgType,
                                          "(timeout:", timeout, ") ==========");
     --logMessage("mmx-frontapi", func, "Frontend request:\n", ing.utils.tableToString(fe_request)) 
 
-    --Create socket and set name (EP Address and port) and timeout
-    local clientsock = socklib.udp(datagramLenMax);
+    --Get socket (shared one or bound to the requested port) and set timeout
+    clientsock, udp_port, shared = mmx_frontapi_get_socket(udp_port)
     if (clientsock == nil) then
-        logMessage("mmx-frontapi",func, "Failed to create socket")
+        logError("mmx-frontapi",func, "Failed to create socket")
         return MMX_ERROR_SOCKET_CREATE, {}
     end
-    for i = 1, 5 do
-        local result, error = clientsock:setsockname(clientAddr, udp_port)
-        if result ~= nil then
-            break
-        end
-        os.execute("sleep 1")
-    end
     timeout = tonumber(timeout) 
     if (timeout == nil) or (timeout < MIN_EP_RESP_TIMEOUT) then 
         timeout = MIN_EP_RESP_TIMEOUT
@@ -853,18 +1637,21 @@ function mmx_frontapi_epexecute_lua(fe_request,  timeout, udp_port)
     clientsock:settimeout(timeout);
 
     -- Convert lua table to xml
+    local start = stats_start()
     msgType = fe_request.header.msgType
-    awaitTxId = fe_request.header.txaId
+    awaitTxId = tostring(fe_request.header.txaId)
     fe_request_xml = mmx_frontapi_message_build(fe_request, udp_port)
-    logMessage("mmx-frontapi",func, "Built XML for", msgType,"request:\n", fe_request_xml) 
+    logDebug("mmx-frontapi",func, "Built XML for", msgType,"request:\n", fe_request_xml) 
 
     --Add 8 bites in beginning of the XML string
     fe_request_xml="00000000"..fe_request_xml
+    local t = stats_lap("build", start)
 
     --Send xml to EP
     res = mmx_frontapi_send(clientsock, fe_request_xml)	
+    t = stats_lap("send", t)
     if res ~= MMX_ERROR_NO_ERROR then
-        logMessage("mmx-frontapi",func,"Sending request",msgType,"to EP failed:",res)
+        logError("mmx-frontapi",func,"Sending request",msgType,"to EP failed:",res)
     else
         if tonumber(fe_request.header.respMode) == MMX_RESMODE_NO_RESP then
             logMessage("mmx-frontapi", func, "Response is not needed for",msgType,"request")	
@@ -874,28 +1661,38 @@ function mmx_frontapi_epexecute_lua(fe_request,  timeout, udp_port)
     end
 
     local start_time = os.time()
+    local mergeLengths = {}
+    local fragments = 0
     while wait_for_response and res == MMX_ERROR_NO_ERROR do
         res, ep_response_xml = mmx_frontapi_receive(clientsock)			
         if res ~= MMX_ERROR_NO_ERROR then
-            logMessage("mmx-frontapi", func, " Failed to receive response from EP:",res)
+            logError("mmx-frontapi", func, " Failed to receive response from EP:",res)
             break 
         end
+        t = stats_lap("wait", t)
 
         logMessage("mmx-frontapi", func, "EP XML response successfully received") 
         --logMessage("XML response:\n",ep_response_xml)   
 
         local parsed_response_tab
         res, parsed_response_tab = mmx_frontapi_message_parse(ep_response_xml)
-        logMessage("mmx-frontapi", func, "Response parsing results (", res, "):\n", 
-                   ing.utils.tableToString(parsed_response_tab))	           
+        t = stats_lap("parse", t)
+        logDebug("mmx-frontapi", func, "Response parsing results (", res, "):\n", 
+                 function() return ing.utils.tableToString(parsed_response_tab) end)
         if res ~= MMX_ERROR_NO_ERROR then
-            logMessage("mmx-frontapi", func, " Failed to parse response from EP:",res)
+            logError("mmx-frontapi", func, " Failed to parse response from EP:",res)
+            stats_count("discarded")
             break
         end
 
         if parsed_response_tab["hdr"]["txaId"] == awaitTxId then
             ep_response_tab["hdr"] = parsed_response_tab["hdr"]
-            mmx_frontapi_message_merge(ep_response_tab["body"], parsed_response_tab["body"])
+            fragments = mmx_frontapi_count_fragment(ep_response_tab, parsed_response_tab["hdr"], fragments)
+            if fragment_handler then
+                fragment_handler(parsed_response_tab)
+            else
+                mmx_frontapi_message_merge(ep_response_tab["body"], parsed_response_tab["body"], mergeLengths)
+            end
             if parsed_response_tab["hdr"]["moreFlag"] == "0" then
                 -- Successfully finished receiving response fragments
                 break
@@ -904,23 +1701,111 @@ function mmx_frontapi_epexecute_lua(fe_request,  timeout, udp_port)
             -- Just ignore response packets with wrong txaId
             logMessage("mmx-frontapi", func, " Received response from EP with wrong txaId: ",
                        parsed_response_tab["hdr"]["txaId"], ", expected: ", awaitTxId)
+            stats_count("discarded")
         end
         -- Check guard timeout for full response
         if wait_for_response and (os.time() - start_time) > timeout then
             -- Timeout exceeded and response not completely received, so force stop waiting and return error
-            logMessage("mmx-frontapi", func, " Global timeout during waiting response from EP")
+            logError("mmx-frontapi", func, " Global timeout during waiting response from EP")
             break
         end
     end
     
-    -- Free socket!
-    clientsock:close()
+    -- Free socket (the shared one is kept unless it failed)
+    mmx_frontapi_release_socket(clientsock, shared,
+                                res == MMX_ERROR_SENDTO_ERROR or res == MMX_ERROR_RECEIVEFROM_ERROR)
+    stats_done(msgType, res, start)
     
     logMessage("mmx-frontapi","========== End of", msgType,"request processing ( res:",
                 res,") ==========\n")
     return res, ep_response_tab
 end
 
+--[[--------------------------------------------------------------------
+  Function name: mmx_frontapi_delta_merge
+  Description:
+     Merges GetParamValue response to a delta request into the cache of
+     the caller: values changed since the version of the request update
+     or extend the cached ones, "not modified" response keeps them and a
+     response with all values replaces them.
+  Input parameters:
+     cache    - table kept by the caller between the requests ({} at first):
+                  version - version of the cached values (nil - no values),
+                  pairs   - cached name-value pairs (as paramNameValuePairs),
+                  index   - position of every name in pairs
+     response - parsed response (see mmx_frontapi_epexecute_lua); its
+                incomplete flag (a fragment was lost or reordered) makes the
+                next request get all values
+  Output:
+     cached name-value pairs
+-------------------------------------------------------------------------]]
+function mmx_frontapi_delta_merge(cache, response)
+    local hdr = response.hdr or {}
+    local values = (response.body or {}).paramNameValuePairs or {}
+
+    if hdr.delta == "1" and cache.pairs then
+        local list, index = cache.pairs, cache.index
+        for _, pair in ipairs(values) do
+            local pos = index[pair.name]
+            if pos then
+                list[pos] = pair
+            else
+                list[#list + 1] = pair
+                index[pair.name] = #list
+            end
+        end
+    elseif hdr.delta ~= "2" or not cache.pairs then
+        -- All values: parameters removed since the last request are dropped
+        local index = {}
+        for i, pair in ipairs(values) do
+            index[pair.name] = i
+        end
+        cache.pairs, cache.index = values, index
+    end
+
+    -- Entry-Points without versions send all values every time; values of
+    -- a response with lost or reordered fragments are valid for no version
+    if response.incomplete then
+        cache.version = nil
+    else
+        cache.version = hdr.version
+    end
+    return cache.pairs
+end
+
+--[[--------------------------------------------------------------------
+  Function name: mmx_frontapi_epexecute_delta
+  Description:
+     Executes GetParamValue request as mmx_frontapi_epexecute_lua does,
+     but sends the version of the values kept in the cache, so the
+     Entry-Point answers with only the values changed since then (or with
+     "not modified"). The response is merged into the cache (see
+     mmx_frontapi_delta_merge) and its body gets all cached values, so the
+     caller sees the full result. A cache keeps the result of one request
+     (the same parameter names every time).
+  Input parameters:
+     fe_request - GetParamValue request in Lua table format
+     cache      - table kept by the caller between the requests ({} at first)
+     timeout, udp_port - see mmx_frontapi_epexecute_lua
+  Output:
+     res_code, ep_response - see mmx_frontapi_epexecute_lua. The cache is
+                   not changed by failed requests. paramNameValuePairs of
+                   the response is the cached table, it must not be changed.
+-------------------------------------------------------------------------]]
+function mmx_frontapi_epexecute_delta(fe_request, cache, timeout, udp_port)
+    fe_request.header.version = cache.version
+    local res, ep_response = mmx_frontapi_epexecute_lua(fe_request, timeout, udp_port)
+    fe_request.header.version = nil
+
+    if res ~= MMX_ERROR_NO_ERROR or ep_response.hdr == nil or
+       tonumber(ep_response.hdr.resCode) ~= MMX_ERROR_NO_ERROR then
+        return res, ep_response
+    end
+
+    ep_response.body.paramNameValuePairs = mmx_frontapi_delta_merge(cache, ep_response)
+    return res, ep_response
+end
+
 --[[-------------------------------------------------------------------------
     Function name: mmx_frontapi_epexecute_xml
     This function is similar to the previous one (mmx_frontapi_epexecute_lua),
@@ -928,7 +1813,10 @@ end
     not Lua-tables.
     Input parameters:
        fe_request_xml - request from frontend to EP in xml format
+                        (respPort of the request is replaced by the port
+                        of the shared client socket)
        timeout    - value of timeout for response 
+       udp_port   - optional local UDP port used for receiving the response
     Output parameters:
        res_code - integer result code: 0 - in case of success, 
                                        otherwise - failure 
@@ -942,33 +1830,22 @@ function mmx_frontapi_epexecute_xml(fe_request_xml,  timeout, udp_port)
     local func = "mmx_frontapi_epexecute_xml:"
     local res, ep_response_xml, msgType = MMX_ERROR_NO_ERROR, "", ""
     local ep_response_xml
-    local datagramLenMax = 32768
+    local clientsock, shared
     --Validate input
     if fe_request_xml == nil then
-        logMessage("mmx-frontapi",func, "Empty request from frontend")
+        logError("mmx-frontapi",func, "Empty request from frontend")
         return MMX_ERROR_FEREQUEST_ERROR, {}
     end
-    if udp_port == nil then
-        udp_port = clientport_receive
-    end
     logMessage("mmx-frontapi","========== New request (timeout:", timeout, ") ==========");
-    logMessage("mmx-frontapi", func, "Frontend request:\n", fe_request_xml) 
+    logDebug("mmx-frontapi", func, "Frontend request:\n", fe_request_xml) 
 
-    --Create socket and set name (EP Address and port) and timeout
-    local clientsock = socklib.udp(datagramLenMax);
+    --Get socket (shared one or bound to the requested port)
+    clientsock, udp_port, shared = mmx_frontapi_get_socket(udp_port)
     if (clientsock == nil) then
-        logMessage("mmx-frontapi",func, "Failed to create socket")
+        logError("mmx-frontapi",func, "Failed to create socket")
         return MMX_ERROR_SOCKET_CREATE, {}
     end
 
-    for i = 1, 5 do
-        local result, error = clientsock:setsockname(clientAddr, udp_port)
-        if result ~= nil then
-            break
-        end
-        os.execute("sleep 1")
-    end
-
     timeout = tonumber(timeout) 
     if (timeout == nil) or (timeout < MIN_EP_RESP_TIMEOUT) then 
         timeout = MIN_EP_RESP_TIMEOUT
@@ -978,38 +1855,62 @@ function mmx_frontapi_epexecute_xml(fe_request_xml,  timeout, udp_port)
     clientsock:settimeout(timeout);
 
 
-    --Retrieve respMode and msgType fields from the request header.
-    local respMode, msgType
-    local xvalue = nil
-    local respXml = xml.eval(fe_request_xml);
-    xvalue = respXml:find("respMode") or {}
-    respMode = xvalue[1]
-    xvalue = respXml:find("msgType") or {}
-    msgType = xvalue[1]
+    --Retrieve respMode, msgType and txaId fields from the request header.
+    local start = stats_start()
+    local respMode = string.match(fe_request_xml, "<respMode>%s*(.-)%s*</respMode>")
+    local msgType = string.match(fe_request_xml, "<msgType>%s*(.-)%s*</msgType>")
+    local awaitTxId = string.match(fe_request_xml, "<txaId>%s*(.-)%s*</txaId>")
+
+    --Response must be sent to the port of our socket
+    if shared then
+        fe_request_xml = string.gsub(fe_request_xml, "<respPort>.-</respPort>",
+                                     "<respPort>"..udp_port.."</respPort>", 1)
+    end
 
     --Add 8 bites in beginning of the XML string
     fe_request_xml="00000000"..fe_request_xml
+    local t = stats_lap("build", start)
 
     --Send xml to EP
     res = mmx_frontapi_send(clientsock, fe_request_xml)	
+    t = stats_lap("send", t)
     if res == MMX_ERROR_NO_ERROR then
         if tonumber(respMode) ~= MMX_RESMODE_NO_RESP then		
-            res, ep_response_xml = mmx_frontapi_receive(clientsock)			
+            -- Skip responses to other (e.g. timed out) requests
+            local start_time = os.time()
+            while true do
+                res, ep_response_xml = mmx_frontapi_receive(clientsock)
+                if res == MMX_ERROR_NO_ERROR then
+                    t = stats_lap("wait", t)
+                end
+                if res ~= MMX_ERROR_NO_ERROR or awaitTxId == nil or
+                   string.match(ep_response_xml, "<txaId>%s*(.-)%s*</txaId>") == awaitTxId then
+                    break
+                end
+                logMessage("mmx-frontapi", func, " Received response from EP with wrong txaId, expected: ", awaitTxId)
+                stats_count("discarded")
+                if (os.time() - start_time) > timeout then
+                    res = MMX_ERROR_RECEIVEFROM_ERROR
+                    break
+                end
+            end
             if res == MMX_ERROR_NO_ERROR then
                 logMessage("mmx-frontapi", func, "Receiving response from EP succeeded")  
-                logMessage("mmx-frontapi", func, "Received XML response: \n",ep_response_xml)    
+                logDebug("mmx-frontapi", func, "Received XML response: \n",ep_response_xml)    
             else
-                logMessage("mmx-frontapi", func, " Failed to receive response from EP:",res)    
+                logError("mmx-frontapi", func, " Failed to receive response from EP:",res)    
             end
         else -- Response is not needed
             logMessage("mmx-frontapi", func, "Response is not needed for",msgType,"request")	
         end
     else  -- Request sending failed
-        logMessage("mmx-frontapi",func,"Sending request",msgType,"to EP failed:",res) 
+        logError("mmx-frontapi",func,"Sending request",msgType,"to EP failed:",res) 
     end
 
-    -- Free socket!
-    clientsock:close()
+    -- Free socket (the shared one is kept unless it failed)
+    mmx_frontapi_release_socket(clientsock, shared,
+                                res == MMX_ERROR_SENDTO_ERROR or res == MMX_ERROR_RECEIVEFROM_ERROR)
+    stats_done(msgType, res, start)
 
     logMessage("mmx-frontapi","========== End of", msgType,"request processing ( res:",
                 res,") ==========\n")
@@ -1018,4 +1919,178 @@ function mmx_frontapi_epexecute_xml(fe_request_xml,  timeout, udp_port)
 
 end
 
+-- Resumes task coroutine of the batch; the completion callback of the task
+-- gets its results (false and error message if it failed)
+local function batch_resume(batch, co, ...)
+    local function finish(ok, ...)
+        if not ok then
+            batch.tasks[co](false, (...))
+        elseif coroutine.status(co) == "dead" then
+            batch.tasks[co](true, ...)
+        end
+    end
+    finish(coroutine.resume(co, ...))
+end
+
+--[[-------------------------------------------------------------------------
+    Function name: mmx_frontapi_all
+    Executes several independent EP requests concurrently on the shared
+    client socket and waits for all of them (but not longer than the 
+    timeout for the whole batch).
+    Every task is either a request table or a function. Functions are run
+    as coroutines: mmx_frontapi_epexecute_lua called from them (directly or
+    e.g. from MMXAPIWrapper methods) sends the request and lets other tasks
+    run while the response is awaited. mmx_frontapi_all called from a task
+    adds its tasks to the running batch and waits for them.
+    Input parameters:
+       tasks   - array of request tables and/or functions
+       timeout - overall deadline of the batch in seconds (it is limited
+                 in the same way as timeout of mmx_frontapi_epexecute_lua)
+    Output parameters:
+       results - array with result of every task (in order of the tasks):
+                 {res_code, ep_response} for request tables, 
+                 packed return values for functions
+                 ({false, error message} if the function failed)
+
+    Example:
+       local results = mmx_frontapi_all({request1, request2}, 5)
+       local res1, resp1 = results[1][1], results[1][2]
+-----------------------------------------------------------------------------]]
+function mmx_frontapi_all(tasks, timeout)
+    local func = "mmx_frontapi_all:"
+    local results = {}
+    local batch
+
+    timeout = tonumber(timeout) 
+    if (timeout == nil) or (timeout < MIN_EP_RESP_TIMEOUT) then 
+        timeout = MIN_EP_RESP_TIMEOUT
+    elseif timeout > MAX_EP_RESP_TIMEOUT then
+        timeout = MAX_EP_RESP_TIMEOUT
+    end
+
+    -- Completion callback of the i-th task
+    local function task_done(i)
+        return function(ok, ...)
+            if not ok then
+                logError("mmx-frontapi", func, "Task", i, "failed:", (...))
+                results[i] = {false, (...)}
+            else
+                results[i] = {...}
+            end
+        end
+    end
+
+    local function task_function(task)
+        if type(task) == "function" then
+            return task
+        end
+        return function() return mmx_frontapi_epexecute_lua(task, timeout) end
+    end
+
+    -- Nested batch: the tasks join the outer batch (they yield while their
+    -- responses are awaited, so they may not run under pcall of the caller)
+    -- and the calling task is suspended until all of them complete
+    local parent = coroutine.running()
+    if activeBatch ~= nil and parent ~= nil and activeBatch.tasks[parent] ~= nil then
+        local outer, remaining, suspended = activeBatch, 0, false
+        for i, task in ipairs(tasks or {}) do
+            local co, done = coroutine.create(task_function(task)), task_done(i)
+            remaining = remaining + 1
+            outer.tasks[co] = function(...)
+                done(...)
+                remaining = remaining - 1
+                if remaining == 0 and suspended then
+                    batch_resume(outer, parent)
+                end
+            end
+            batch_resume(outer, co)
+        end
+        if remaining > 0 then
+            suspended = true
+            coroutine.yield()
+        end
+        return results
+    end
+
+    -- Called by the batch itself (e.g. from a fragment handler): sequentially
+    if activeBatch ~= nil then
+        for i, task in ipairs(tasks or {}) do
+            task_done(i)(pcall(task_function(task)))
+        end
+        return results
+    end
+
+    local sock, port, shared = mmx_frontapi_get_socket(nil)
+    if sock == nil then
+        logError("mmx-frontapi", func, "Failed to create socket")
+        for i = 1, #(tasks or {}) do
+            results[i] = {MMX_ERROR_SOCKET_CREATE, {}}
+        end
+        return results
+    end
+
+    batch = {sock = sock, port = port, waiting = {}, tasks = {},
+             deadline = socklib.gettime() + timeout}
+    activeBatch = batch
+
+    for i, task in ipairs(tasks or {}) do
+        local co = coroutine.create(task_function(task))
+        batch.tasks[co] = task_done(i)
+        batch_resume(batch, co)
+    end
+
+    -- Dispatch responses to the tasks waiting for them
+    local res = MMX_ERROR_NO_ERROR
+    while next(batch.waiting) ~= nil do
+        local remaining = batch.deadline - socklib.gettime()
+        if remaining <= 0 then
+            logError("mmx-frontapi", func, "Deadline of the batch is reached")
+            break
+        end
+        sock:settimeout(remaining)
+
+        local ep_response_xml, parsed_response_tab, parse_res
+        local t = stats_start()
+        res, ep_response_xml = mmx_frontapi_receive(sock)
+        if res ~= MMX_ERROR_NO_ERROR then
+            logError("mmx-frontapi", func, " Failed to receive response from EP:", res)
+            break
+        end
+        t = stats_lap("wait", t)
+
+        parse_res, parsed_response_tab = mmx_frontapi_message_parse(ep_response_xml)
+        stats_lap("parse", t)
+        local txaId = parse_res == MMX_ERROR_NO_ERROR and parsed_response_tab["hdr"]["txaId"]
+        local pending = txaId and batch.waiting[txaId]
+        if pending then
+            pending.response["hdr"] = parsed_response_tab["hdr"]
+            pending.fragments = mmx_frontapi_count_fragment(pending.response, parsed_response_tab["hdr"],
+                                                            pending.fragments)
+            if pending.handler then
+                pending.handler(parsed_response_tab)
+            else
+                mmx_frontapi_message_merge(pending.response["body"], parsed_response_tab["body"], pending.lengths)
+            end
+            if parsed_response_tab["hdr"]["moreFlag"] == "0" then
+                batch.waiting[txaId] = nil
+                batch_resume(batch, pending.co, MMX_ERROR_NO_ERROR, pending.response)
+            end
+        else
+            logMessage("mmx-frontapi", func, " Skipped response from EP with unknown txaId:", txaId)
+            stats_count("discarded")
+        end
+    end
+
+    -- Complete the tasks which did not get their responses in time
+    batch.closed = true
+    while next(batch.waiting) ~= nil do
+        local txaId, pending = next(batch.waiting)
+        batch.waiting[txaId] = nil
+        batch_resume(batch, pending.co, MMX_ERROR_RECEIVEFROM_ERROR, pending.response)
+    end
 
+    activeBatch = nil
+    mmx_frontapi_release_socket(sock, shared, res ~= MMX_ERROR_NO_ERROR)
+
+    return results
+end
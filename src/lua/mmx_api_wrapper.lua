@@ -83,6 +83,33 @@ MMXAPIWrapper.__index = MMXAPIWrapper
 -- max number of object instances, which can be retrieved with one GET request
 local MAX_GET_INSTANCE_SIZE = 8
 
+-- time (in seconds) during which instance indexes resolved by getIndexByParamValue are reused
+local INDEX_CACHE_TTL = 5
+
+-- reverse indexes of table columns used by getIndexByParamValue:
+-- indexCache[columnPath] = {time = ..., table = <path of the table>, indexes = {[value] = index}},
+-- where columnPath is path to parameter with "*" instead of instance number
+local indexCache = {}
+
+---
+-- Drops cached reverse indexes of the tables affected by change of object {objPath}
+--
+-- @param objPath string Path to changed (added, deleted or set) object
+--
+local function invalidateIndexCache(objPath)
+    if objPath == nil then
+        indexCache = {}
+        return
+    end
+    for columnPath, entry in pairs(indexCache) do
+        local tablePath = entry.table
+        if string.sub(objPath, 1, #tablePath) == tablePath or
+           string.sub(tablePath, 1, #objPath) == objPath then
+            indexCache[columnPath] = nil
+        end
+    end
+end
+
 ---
 -- Constructor
 --
@@ -189,49 +216,6 @@ function MMXAPIWrapper:get(path, params)
 end
 ]]--
 
----
--- Filters all given {data}, leaving only entries, which match given {paramPath}
---
--- @param data       table  Associatiative array of data entries
--- @param paramPath  string Path with possible placeholders ("{i}" and/or "*") against which all data entries must be filtered
--- @return table    Subset of indirect data entries, which match given {paramPath} or empty table if no such entries were found
---
--- @usage   MMXWebEngine:filterAssocParams({["Device.IP.Interface.1.Name"] = "eth0", ["Device.Bridging.Bridge.1.VLAN.2.VLANID"] = "20"}, "Device.IP.Interface.{i}.Name")
---              --> {["Device.IP.Interface.1.Name"] = "eth0"}
--- @usage   MMXWebEngine:filterAssocParams({["Device.Bridging.Bridge.1.VLAN.1.VLANID"] = "10", ["Device.Bridging.Bridge.2.VLAN.1.VLANID"] = "20"}, "Device.Bridging.Bridge.1.VLAN.*.VLANID")
---              --> {["Device.Bridging.Bridge.1.VLAN.1.VLANID"] = "10"}
---
-local function filterAssocParams(data, paramPath)
-    local filteredData = {}
-    local paramPathParts = ing.utils.split(paramPath, ".")
-    local pathPartCount = #paramPathParts
-
-    for dataPath, data in pairs(data) do
-        local dataPathParts = ing.utils.split(dataPath, ".")
-
-        -- compare both paths length
-        if pathPartCount <= #dataPathParts then
-            -- compare both paths part by part
-            local similarParts = 0
-            for i = 1, pathPartCount do
-                local isPlaceholder = paramPathParts[i] == "{i}" or paramPathParts[i] == "*"
-                if paramPathParts[i] == dataPathParts[i] or (isPlaceholder and tonumber(dataPathParts[i])) then
-                    similarParts = similarParts + 1
-                else
-                    break
-                end
-            end
-
-            -- if all paths parts are equal - add this data entry into filtered data
-            if similarParts == pathPartCount then
-                filteredData[dataPath] = data
-            end
-        end
-    end
-
-    return filteredData
-end
-
 ---
 -- Performs one GET request to MMX Entrypoint to retreive all parameters on object {path} and returns only required
 -- parameters listed on {params}
@@ -268,9 +252,7 @@ function MMXAPIWrapper:getInstance(path, params)
 
     local assocParams = {}
     if errcode == 0 and response["body"]["paramNameValuePairs"] ~= nil then
-        for _, paramPair in pairs(response["body"]["paramNameValuePairs"]) do
-            assocParams[paramPair["name"]] = paramPair["value"]
-        end
+        assocParams = mmx_frontapi_param_index(response["body"]["paramNameValuePairs"]).values
     end
         --print("<pre>path: Assoc params table"..ing.utils.tableToString(assocParams).."</pre>")
 
@@ -331,10 +313,14 @@ function MMXAPIWrapper:getMultipleInstances(pathParamTable, instanceMaxCount)
     -- table with names of parameters to get in current request
     local requestParamNames = {}
 
-    -- table to store parsed responsed from EP
-    local assocParams = {}
+    -- index of parsed responses from EP
+    local paramIndex = mmx_frontapi_param_index({})
+    local assocParams = paramIndex.values
+
+    -- requests to be sent concurrently
+    local requests = {}
 
-    -- number of paths, which were already processed (added (and, maybe, sent) to request)
+    -- number of paths, which were already processed (added to request)
     local processedPaths = 0
     for path, askedParams in pairs(pathParamTable) do
         local nameEntry
@@ -351,7 +337,7 @@ function MMXAPIWrapper:getMultipleInstances(pathParamTable, instanceMaxCount)
         processedPaths = processedPaths + 1
 
         -- if limit of asked instances for one request is achieved
-        -- or last asked path was added to requested one - sent request immediately
+        -- or last asked path was added to requested one - prepare the request
         if #requestParamNames == getInstanceCount or processedPaths == pathParamSize then
             local request = {
                 -- request header
@@ -367,46 +353,54 @@ function MMXAPIWrapper:getMultipleInstances(pathParamTable, instanceMaxCount)
                     paramNames = requestParamNames
                 }
             } -- request end
+            table.insert(requests, request)
 
-            local errCode, response = mmx_frontapi_epexecute_lua(request, 3)
-            -- print("<pre> Received response from front API"..ing.utils.tableToString(response).."</pre>")
-            if errCode == 0 then
-                -- if request was successfully sent to EP
-                -- and response was received and parsed without problems - check response header for errors
-                errCode = tonumber(response["hdr"]["resCode"])
-            end
+            -- clear list of paths to request
+            requestParamNames = {}
+        end
+    end
 
-            combinedErrorCode = math.max(combinedErrorCode, errCode)
+    -- send all requests at once and wait for all responses
+    for _, result in ipairs(mmx_frontapi_all(requests, 3)) do
+        local errCode, response = result[1], result[2]
+        if type(errCode) ~= "number" then
+            -- request failed with Lua error - treat it as internal error
+            errCode = 9002
+        end
+        -- print("<pre> Received response from front API"..ing.utils.tableToString(response).."</pre>")
+        if errCode == 0 then
+            -- if request was successfully sent to EP
+            -- and response was received and parsed without problems - check response header for errors
+            errCode = tonumber(response["hdr"]["resCode"])
+        end
 
-            if errCode == 0 and response["body"]["paramNameValuePairs"] ~= nil then
-                for _, paramPair in pairs(response["body"]["paramNameValuePairs"]) do
-                    assocParams[paramPair["name"]] = paramPair["value"]
-                end
-            end
-            -- print("<pre>path: Assoc params table"..ing.utils.tableToString(assocParams).."</pre>")
+        combinedErrorCode = math.max(combinedErrorCode, errCode)
 
-            -- clear list of paths to request
-            requestParamNames = {}
+        if errCode == 0 and response["body"]["paramNameValuePairs"] ~= nil then
+            mmx_frontapi_param_index(response["body"]["paramNameValuePairs"], paramIndex)
         end
     end
+    -- print("<pre>path: Assoc params table"..ing.utils.tableToString(assocParams).."</pre>")
 
     for path, wantedParams in pairs(pathParamTable) do
         if string.find(path, "*", 1, true) then
-            -- requested path contains placeholders - get all params, which match given placeholder
-            local filteredAssocParams = filterAssocParams(assocParams, path)
-
-            for paramFullName, paramValue in pairs(filteredAssocParams) do
-                local paramPath, paramName = self:splitMngObjPath(paramFullName)
-
-                -- check if given param was asked
-                if ing.utils.tableContainsValue(wantedParams, paramName) then
-                    -- get table with name-values pairs for given instance path
-                    local pathFields = retRows[paramPath] or {}
+            -- requested path contains placeholders - get asked params of all instances,
+            -- which match given placeholders, walking the path trie of the index
+            local wantedSet = {}
+            for _, paramName in pairs(wantedParams) do
+                wantedSet[paramName] = true
+            end
 
-                    pathFields[paramName] = paramValue
+            for paramPath, pathFields in pairs(mmx_frontapi_index_match(paramIndex, path, wantedSet)) do
+                for paramName, paramValue in pairs(pathFields) do
                     errRows[paramName] = combinedErrorCode
-
-                    -- override existing param table with updated values
+                end
+                -- merge with params already found for given instance path
+                if retRows[paramPath] then
+                    for paramName, paramValue in pairs(pathFields) do
+                        retRows[paramPath][paramName] = paramValue
+                    end
+                else
                     retRows[paramPath] = pathFields
                 end
             end
@@ -436,6 +430,9 @@ end
 -- @return index number Founded index for this object or nil
 -- @usage For example we have next query parameter 'routerid=a323b336-9177-4b32-a93f-5a4edeef2226'
 --        We found next path 'Device.Routers.1.Device' for this router-id and resulting index=1
+
+-- @note  The whole column is fetched once and its reverse index (value -> index) is reused
+--        during INDEX_CACHE_TTL seconds or until the table is changed via this wrapper
 --
 function MMXAPIWrapper:getIndexByParamValue(path, value, ep_timeout)
 
@@ -448,6 +445,12 @@ function MMXAPIWrapper:getIndexByParamValue(path, value, ep_timeout)
 
     local requestObj = string.gsub(path, "{i}", "*", 1)
 
+    -- use reverse index of the column, if it was built recently
+    local cached = indexCache[requestObj]
+    if cached and os.time() - cached.time < INDEX_CACHE_TTL then
+        return cached.indexes[value]
+    end
+
     local fe_request = {
         header = {
             callerId = self.callerId,
@@ -469,19 +472,25 @@ function MMXAPIWrapper:getIndexByParamValue(path, value, ep_timeout)
         return nil
     end
 
-    local index = nil
-    if (response["body"]["paramNameValuePairs"]) then
-        for key, responseTable in pairs(response["body"]["paramNameValuePairs"]) do
-            if value == responseTable["value"] then
-                index = (string.match (responseTable["name"], "^.+%.(%d+)%..+$"))
-                break
-            end
-        end
-    else
+    if not response["body"]["paramNameValuePairs"] then
         return nil
     end
 
-    return index
+    -- build reverse index of the whole column: value -> index of the first instance having it
+    local indexes = {}
+    for _, responseTable in ipairs(response["body"]["paramNameValuePairs"]) do
+        local paramValue = responseTable["value"]
+        if paramValue ~= nil and indexes[paramValue] == nil then
+            indexes[paramValue] = (string.match (responseTable["name"] or "", "^.+%.(%d+)%..+$"))
+        end
+    end
+    indexCache[requestObj] = {
+        time = os.time(),
+        table = string.sub(requestObj, 1, string.find(requestObj, "*", 1, true) - 1),
+        indexes = indexes
+    }
+
+    return indexes[value]
 end
 
 ---
@@ -649,6 +658,7 @@ function MMXAPIWrapper:setParamValue (objInstName, setType, setValues)
     --print("request:\n"..ing.utils.tableToString(request))
     -- sent request to entry point
     local errcode, response = mmx_frontapi_epexecute_lua(request, 6)
+    invalidateIndexCache(objInstName)
     if errcode == 0 then
         -- if request was successfully sent to EP and response was received and parsed without problems - check response header for errors
         errcode = tonumber(response["hdr"]["resCode"])
@@ -689,6 +699,7 @@ function MMXAPIWrapper:addInstance(objectPath, params)
         }
     }
     local errcode, response = mmx_frontapi_epexecute_lua(request, 6)
+    invalidateIndexCache(objectPath)
     if errcode == 0 then
         -- if request was successfully sent to EP and response was received and parsed without problems - check response header for errors
         errcode = tonumber(response["hdr"]["resCode"])
@@ -725,6 +736,7 @@ function MMXAPIWrapper:deleteInstance(objInstName)
         }
     }
     local errcode, response = mmx_frontapi_epexecute_lua(request, 6)
+    invalidateIndexCache(objInstName)
     if errcode == 0 then
         -- if request was successfully sent to EP and response was received and parsed without problems - check response header for errors
         errcode = tonumber(response["hdr"]["resCode"])